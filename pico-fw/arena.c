@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+// If non-zero, abort on any allocation after arena_seal(). Used to check that nothing allocates in
+// the steady state.
+#ifndef ARENA_ASSERT_SEALED
+#define ARENA_ASSERT_SEALED 0
+#endif
+
+// Every block starts with a header giving the size of the block, header included, and whether it
+// is in use. Blocks follow each other without gaps up to the end of the arena.
+typedef struct {
+  uint32_t size;
+  uint32_t used;
+} arena_block_t;
+
+#define ARENA_ALIGN sizeof(arena_block_t)
+
+static uint8_t *arena_start, *arena_end;
+static arena_stats_t arena_stats;
+static bool arena_sealed;
+
+static inline arena_block_t *arena_next_block(arena_block_t *block) {
+  return (arena_block_t *)((uint8_t *)block + block->size);
+}
+
+// Block size needed for an allocation of size bytes. Blocks are never smaller than the minimum
+// arena_split() leaves behind so that free space merged into a block can always be split off again.
+static inline size_t arena_block_size(size_t size) {
+  if (size < ARENA_ALIGN) {
+    size = ARENA_ALIGN;
+  }
+  return (sizeof(arena_block_t) + size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+// Merge any free blocks following block into it.
+static void arena_merge_free(arena_block_t *block) {
+  for (arena_block_t *next = arena_next_block(block);
+       ((uint8_t *)next != arena_end) && !next->used; next = arena_next_block(block)) {
+    block->size += next->size;
+  }
+}
+
+// Split the unused tail off a block if it is large enough to hold another block.
+static void arena_split(arena_block_t *block, size_t size) {
+  if (block->size - size >= arena_block_size(0)) {
+    arena_block_t *rest = (arena_block_t *)((uint8_t *)block + size);
+    rest->size = block->size - size;
+    rest->used = 0;
+    block->size = size;
+  }
+}
+
+// Account for a change in allocated bytes.
+static void arena_account(size_t old_size, size_t new_size) {
+  arena_stats.used += new_size - old_size;
+  if (arena_stats.used > arena_stats.high_water) {
+    arena_stats.high_water = arena_stats.used;
+  }
+}
+
+static bool arena_check_sealed(void) {
+  if (arena_sealed) {
+    arena_stats.n_allocs_after_seal++;
+    if (ARENA_ASSERT_SEALED) {
+      abort();
+    }
+  }
+  return arena_sealed;
+}
+
+void arena_init(void *mem, size_t size) {
+  arena_start = (uint8_t *)(((uintptr_t)mem + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1));
+  size -= arena_start - (uint8_t *)mem;
+  arena_end = arena_start + (size & ~(ARENA_ALIGN - 1));
+
+  arena_block_t *block = (arena_block_t *)arena_start;
+  block->size = arena_end - arena_start;
+  block->used = 0;
+
+  memset(&arena_stats, 0, sizeof(arena_stats));
+  arena_stats.size = arena_end - arena_start;
+  arena_sealed = false;
+}
+
+void *arena_alloc(size_t size) {
+  arena_check_sealed();
+
+  size_t block_size = arena_block_size(size);
+  for (arena_block_t *block = (arena_block_t *)arena_start; (uint8_t *)block != arena_end;
+       block = arena_next_block(block)) {
+    if (block->used) {
+      continue;
+    }
+    arena_merge_free(block);
+    if (block->size < block_size) {
+      continue;
+    }
+
+    arena_split(block, block_size);
+    block->used = 1;
+    arena_stats.n_allocs++;
+    arena_account(0, block->size);
+
+    void *ptr = block + 1;
+    memset(ptr, 0, block->size - sizeof(arena_block_t));
+    return ptr;
+  }
+
+  arena_stats.n_failures++;
+  return NULL;
+}
+
+void *arena_calloc(size_t n, size_t size) {
+  if ((size != 0) && (n > SIZE_MAX / size)) {
+    arena_stats.n_failures++;
+    return NULL;
+  }
+  return arena_alloc(n * size);
+}
+
+void *arena_realloc(void *ptr, size_t size) {
+  if (ptr == NULL) {
+    return arena_alloc(size);
+  }
+
+  arena_block_t *block = (arena_block_t *)ptr - 1;
+  size_t old_size = block->size, block_size = arena_block_size(size);
+
+  // Shrink or grow in place where possible, otherwise give back any free space merged in.
+  arena_merge_free(block);
+  if (block->size >= block_size) {
+    if (block_size > old_size) {
+      arena_check_sealed();
+    }
+    arena_split(block, block_size);
+    // Keep everything past the requested size zeroed so that later growth reads as zero.
+    if (block->size > old_size) {
+      memset((uint8_t *)block + old_size, 0, block->size - old_size);
+    }
+    memset((uint8_t *)ptr + size, 0, block->size - sizeof(arena_block_t) - size);
+    arena_account(old_size, block->size);
+    return ptr;
+  }
+  arena_split(block, old_size);
+
+  void *new_ptr = arena_alloc(size);
+  if (new_ptr == NULL) {
+    return NULL;
+  }
+  memcpy(new_ptr, ptr, old_size - sizeof(arena_block_t));
+  arena_free(ptr);
+  return new_ptr;
+}
+
+void arena_free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+  arena_block_t *block = (arena_block_t *)ptr - 1;
+  block->used = 0;
+  arena_stats.n_frees++;
+  arena_account(block->size, 0);
+}
+
+void arena_seal(void) { arena_sealed = true; }
+
+void arena_get_stats(arena_stats_t *stats) { *stats = arena_stats; }
@@ -0,0 +1,38 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A fixed arena from which all long-lived allocations are made in place of the heap. Blocks are
+// allocated first-fit and adjacent free blocks are merged so that a repeated sequence of
+// allocations, as made by a mode or font change, always lands in the same place.
+
+// Allocation statistics. Sizes are in bytes and include per-block overhead.
+typedef struct {
+  size_t size;       // total arena size
+  size_t used;       // currently allocated
+  size_t high_water; // most ever allocated at once
+  uint32_t n_allocs, n_frees, n_failures;
+  uint32_t n_allocs_after_seal;
+} arena_stats_t;
+
+// Use size bytes at mem as the arena. Any previous arena is forgotten.
+void arena_init(void *mem, size_t size);
+
+// Allocate size bytes of zeroed memory, or return NULL if there is no free block large enough.
+void *arena_alloc(size_t size);
+
+// Allocate a zeroed array of n elements of size bytes as for calloc().
+void *arena_calloc(size_t n, size_t size);
+
+// Resize an allocation as for realloc(). Any new space is zeroed. The block is grown in place if
+// the following block is free. Return NULL, leaving ptr allocated, if there is no room.
+void *arena_realloc(void *ptr, size_t size);
+
+// Return an allocation to the arena. NULL is ignored.
+void arena_free(void *ptr);
+
+// Mark the end of initialisation. Allocations after this are counted in n_allocs_after_seal and,
+// if ARENA_ASSERT_SEALED is non-zero, abort.
+void arena_seal(void);
+
+void arena_get_stats(arena_stats_t *stats);
@@ -1,4 +1,4 @@
-unsigned char cga_8x8_font[] = {
+const unsigned char cga_8x8_font[] = {
   0x00, 0x7e, 0x7e, 0x6c, 0x10, 0x38, 0x10, 0x00, 0xff, 0x00, 0xff, 0x0f,
   0x3c, 0x3f, 0x7f, 0x18, 0x00, 0x81, 0xff, 0xfe, 0x38, 0x7c, 0x10, 0x00,
   0xff, 0x3c, 0xc3, 0x07, 0x66, 0x33, 0x63, 0xdb, 0x00, 0xa5, 0xdb, 0xfe,
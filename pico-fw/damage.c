@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "damage.h"
+
+static inline void span_clear(damage_span_t *span) {
+  span->start_col = INT16_MAX;
+  span->end_col = 0;
+}
+
+static inline void span_add(damage_span_t *span, int start_col, int end_col) {
+  if (start_col < span->start_col) {
+    span->start_col = start_col;
+  }
+  if (end_col > span->end_col) {
+    span->end_col = end_col;
+  }
+}
+
+bool damage_resize(damage_t *damage, int n_rows, int n_cols) {
+  damage_span_t *spans = arena_realloc(damage->spans, sizeof(damage->spans[0]) * n_rows);
+  if (spans == NULL) {
+    return false;
+  }
+  damage->spans = spans;
+  damage->n_rows = n_rows;
+  damage->n_cols = n_cols;
+  damage_clear(damage);
+  return true;
+}
+
+void damage_clear(damage_t *damage) {
+  for (int row = 0; row < damage->n_rows; row++) {
+    span_clear(&damage->spans[row]);
+  }
+}
+
+void damage_clear_row(damage_t *damage, int row) { span_clear(&damage->spans[row]); }
+
+bool damage_is_clear(const damage_t *damage) {
+  for (int row = 0; row < damage->n_rows; row++) {
+    if (damage_row_is_damaged(damage, row)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void damage_all(damage_t *damage) {
+  for (int row = 0; row < damage->n_rows; row++) {
+    damage->spans[row].start_col = 0;
+    damage->spans[row].end_col = damage->n_cols;
+  }
+}
+
+void damage_add_rect(damage_t *damage, int start_row, int end_row, int start_col, int end_col) {
+  if (start_row < 0) {
+    start_row = 0;
+  }
+  if (end_row > damage->n_rows) {
+    end_row = damage->n_rows;
+  }
+  if (start_col < 0) {
+    start_col = 0;
+  }
+  if (end_col > damage->n_cols) {
+    end_col = damage->n_cols;
+  }
+  if (start_col >= end_col) {
+    return;
+  }
+  for (int row = start_row; row < end_row; row++) {
+    span_add(&damage->spans[row], start_col, end_col);
+  }
+}
+
+void damage_merge(damage_t *dst, const damage_t *src) {
+  for (int row = 0; row < dst->n_rows; row++) {
+    if (damage_row_is_damaged(src, row)) {
+      span_add(&dst->spans[row], src->spans[row].start_col, src->spans[row].end_col);
+    }
+  }
+}
+
+void damage_scroll(damage_t *damage, int start_row, int end_row, int n) {
+  if (start_row < 0) {
+    start_row = 0;
+  }
+  if (end_row > damage->n_rows) {
+    end_row = damage->n_rows;
+  }
+  int n_rows = end_row - start_row;
+  if ((n == 0) || (n_rows <= 0)) {
+    return;
+  }
+
+  damage_span_t *spans = damage->spans + start_row;
+  if ((n >= n_rows) || (-n >= n_rows)) {
+    for (int row = 0; row < n_rows; row++) {
+      span_clear(&spans[row]);
+    }
+  } else if (n > 0) {
+    memmove(spans, spans + n, sizeof(spans[0]) * (n_rows - n));
+    for (int row = n_rows - n; row < n_rows; row++) {
+      span_clear(&spans[row]);
+    }
+  } else {
+    memmove(spans - n, spans, sizeof(spans[0]) * (n_rows + n));
+    for (int row = 0; row < -n; row++) {
+      span_clear(&spans[row]);
+    }
+  }
+}
+
+// Add the part of src_row's damage within columns src_col to src_col + n_cols to dst_row, moved
+// across to dst_col.
+static void move_row(damage_t *damage, int dst_row, int dst_col, int src_row, int src_col,
+                     int n_cols) {
+  damage_span_t src = damage->spans[src_row];
+  int start_col = (src.start_col > src_col) ? src.start_col : src_col;
+  int end_col = (src.end_col < src_col + n_cols) ? src.end_col : src_col + n_cols;
+  if (start_col < end_col) {
+    span_add(&damage->spans[dst_row], start_col + dst_col - src_col, end_col + dst_col - src_col);
+  }
+}
+
+void damage_move_rect(damage_t *damage, int dst_row, int dst_col, int src_row, int src_col,
+                      int n_rows, int n_cols) {
+  // Work away from the overlap so that no source row is read after damage was added to it.
+  if (dst_row <= src_row) {
+    for (int i = 0; i < n_rows; i++) {
+      move_row(damage, dst_row + i, dst_col, src_row + i, src_col, n_cols);
+    }
+  } else {
+    for (int i = n_rows - 1; i >= 0; i--) {
+      move_row(damage, dst_row + i, dst_col, src_row + i, src_col, n_cols);
+    }
+  }
+}
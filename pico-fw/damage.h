@@ -0,0 +1,53 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+// Damaged columns start_col (inclusive) to end_col (exclusive) of one terminal row. The span is
+// empty if start_col >= end_col.
+typedef struct {
+  int16_t start_col, end_col;
+} damage_span_t;
+
+// Damage for a whole terminal, stored row-major as one span per row.
+typedef struct {
+  damage_span_t *spans;
+  int n_rows, n_cols;
+} damage_t;
+
+// (Re-)size damage for a terminal of the given geometry. All damage is cleared. Return false if the
+// spans could not be allocated.
+bool damage_resize(damage_t *damage, int n_rows, int n_cols);
+
+// Clear all damage.
+void damage_clear(damage_t *damage);
+
+// Clear the damage for one row.
+void damage_clear_row(damage_t *damage, int row);
+
+// Return true if no row is damaged.
+bool damage_is_clear(const damage_t *damage);
+
+// Mark the whole terminal as damaged.
+void damage_all(damage_t *damage);
+
+// Mark rows start_row to end_row and columns start_col to end_col, both end exclusive, as damaged.
+// The rectangle is clipped to the terminal.
+void damage_add_rect(damage_t *damage, int start_row, int end_row, int start_col, int end_col);
+
+// Add all damage from src to dst. Both must have the same geometry.
+void damage_merge(damage_t *dst, const damage_t *src);
+
+// Move damage for rows start_row to end_row (exclusive) along with contents scrolled up by n rows,
+// or down if n is negative. Damage scrolled outside of the rows is dropped and the rows exposed
+// are left undamaged.
+void damage_scroll(damage_t *damage, int start_row, int end_row, int n);
+
+// Copy damage along with contents moved from the n_rows by n_cols block at (src_row, src_col) to
+// (dst_row, dst_col). Both blocks must lie within the terminal and may overlap. Damage already in
+// the destination is kept so the result may cover more than is strictly needed.
+void damage_move_rect(damage_t *damage, int dst_row, int dst_col, int src_row, int src_col,
+                      int n_rows, int n_cols);
+
+// Return true if the span for row is non-empty.
+static inline bool damage_row_is_damaged(const damage_t *damage, int row) {
+  return damage->spans[row].start_col < damage->spans[row].end_col;
+}
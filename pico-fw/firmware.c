@@ -1,69 +1,299 @@
+#include <inttypes.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "hardware/sync.h"
+#include "pico/multicore.h"
 #include "pico/stdio.h"
 #include "pico/stdlib.h"
-#include "vterm.h"
 
+#include "arena.h"
 #include "cp437_map.h"
+#include "damage.h"
 #include "graphics.h"
+#include "input.h"
+#include "spsc_queue.h"
+#include "term.h"
 #include "videoout.h"
 
+// Only the sizes of the standard modes, which are defined in videoout.c.
+#define VIDEO_MODES_SIZES_ONLY
+#include "video_modes.h"
+
 #define VSYNC_GPIO 2                 // == pin 4
 #define HSYNC_GPIO (VSYNC_GPIO + 1)  // == pin 5
 #define NOTDIM_GPIO 4                // == pin 6
 #define VIDEO_GPIO (NOTDIM_GPIO + 1) // == pin 7
 
-// Terminal state management.
-VTerm *term;
-VTermScreen *term_screen;
-VTermState *term_state;
-VTermColor default_bg_color, default_fg_color;
-VTermPos cursor_pos = {.row = 0, .col = 0};
+// If non-zero, video is generated on the fly from an array of character cells rather than from a
+// frame buffer. This saves the frame buffer memory and makes a cell update a single store.
+#ifndef TEXT_MODE
+#define TEXT_MODE 0
+#endif
+
+// If non-zero, draw into a second frame buffer while the first is shown and flip between them at
+// vblank. This avoids tearing at the cost of a second frame buffer and of waiting for each flip.
+// Falls back to a single frame buffer if two do not fit.
+#ifndef DOUBLE_BUFFER
+#define DOUBLE_BUFFER 0
+#endif
+
+// If non-zero, input is parsed on core 0 while core 1 draws. Core 0 hands each batch of changes to
+// core 1 through a queue, along with the changed cells, so neither waits for the other.
+#ifndef DUAL_CORE
+#define DUAL_CORE 1
+#endif
+
+// Largest screen, by default that of the widest standard mode, and smallest character cell used
+// with set_mode() and set_font(). The arena holding all long-lived allocations is sized from these.
+#ifndef MAX_SCREEN_WIDTH
+#define MAX_SCREEN_WIDTH VIDEO_MODES_MAX_VISIBLE_DOTS_PER_LINE
+#endif
+#ifndef MAX_SCREEN_HEIGHT
+#define MAX_SCREEN_HEIGHT VIDEO_MODES_MAX_VISIBLE_LINES_PER_FRAME
+#endif
+#define MIN_CELL_WIDTH 8
+#define MIN_CELL_HEIGHT 14
+#define MAX_TERM_CELLS                                                                             \
+  ((MAX_SCREEN_WIDTH / MIN_CELL_WIDTH) * (MAX_SCREEN_HEIGHT / MIN_CELL_HEIGHT))
+
+// Size of the buffer holding input received over USB until it is parsed. A power of two.
+#ifndef INPUT_BUFFER_SIZE
+#define INPUT_BUFFER_SIZE 4096
+#endif
+
+// Room for the frame buffer, or the text mode cells, the terminal screen, the snapshot of it drawn
+// from and the input buffer plus an allowance for the terminal backend's other buffers, the glyph
+// cache, damage tracking and the render queue. A second frame buffer for DOUBLE_BUFFER is only used
+// if ARENA_SIZE is raised to fit it.
+#ifndef ARENA_SIZE
+#define ARENA_SIZE                                                                                 \
+  ((TEXT_MODE ? MAX_TERM_CELLS * sizeof(gfx_text_cell_t)                                          \
+              : (MAX_SCREEN_WIDTH / 4) * MAX_SCREEN_HEIGHT) +                                      \
+   (MAX_TERM_CELLS * (TERM_CELL_SIZE + sizeof(gfx_cell_t))) +                                      \
+   (TERM_SCROLLBACK_LINES * TERM_SCROLLBACK_LINE_SIZE(MAX_SCREEN_WIDTH / MIN_CELL_WIDTH)) +       \
+   INPUT_BUFFER_SIZE + (32 * 1024))
+#endif
+
+static uint8_t arena_memory[ARENA_SIZE];
+
+// Terminal state management. The cursor and damage here belong to the renderer, which runs on
+// core 1 if DUAL_CORE is non-zero.
+term_pos_t cursor_pos = {.row = 0, .col = 0};
 bool cursor_visible = true, cursor_moved = true;
-uint32_t *line_damages = NULL;
+
+// Cursor shapes, overlaid on the output by videoout rather than drawn. Set by DECSCUSR, through
+// RENDER_EVENT_CURSOR_SHAPE and set_cursor_shape().
+typedef enum {
+  CURSOR_SHAPE_BLOCK,
+  CURSOR_SHAPE_UNDERLINE,
+  CURSOR_SHAPE_BAR,
+} cursor_shape_t;
+
+cursor_shape_t cursor_shape = CURSOR_SHAPE_BLOCK;
+
+// Fields the cursor is shown and then hidden for when blinking.
+#define CURSOR_BLINK_PERIOD 32
+
+// Fields the screen is flashed in reverse video for by the bell.
+#ifndef VISUAL_BELL_FIELDS
+#define VISUAL_BELL_FIELDS 6
+#endif
+damage_t line_damage;
+
+// Damage and cursor changes reported by the terminal and not yet handed to the renderer.
+damage_t input_damage;
+term_pos_t input_cursor_pos = {.row = 0, .col = 0};
+bool input_cursor_visible = true, input_cursor_changed = true;
+cursor_shape_t input_cursor_shape = CURSOR_SHAPE_BLOCK;
+bool input_cursor_blink = true, input_cursor_shape_changed = false;
+
+// The terminal's cells resolved into glyphs and pixel values, which the renderer draws from. Core 0
+// writes it while seq is odd and the renderer only draws cells read while seq is even and
+// unchanged. Row r is held in row (origin + r) % n_rows so that scrolling the whole screen moves
+// the origin.
+static struct {
+  gfx_cell_t *cells;
+  int n_rows, n_cols, origin;
+  atomic_uint seq;
+} snapshot;
+
+// Changes handed from the terminal to the renderer in the order they were made.
+typedef enum {
+  RENDER_EVENT_DAMAGE,       // rect, one row, is to be drawn from the snapshot
+  RENDER_EVENT_MOVE,         // the contents of src have moved to dest
+  RENDER_EVENT_CURSOR,       // the cursor is now at pos and visible or not
+  RENDER_EVENT_CURSOR_SHAPE, // the cursor is now shown as shape and blinks or not
+} render_event_type_t;
+
+typedef struct {
+  render_event_type_t type;
+  union {
+    term_rect_t rect;
+    struct {
+      term_rect_t dest, src;
+    } move;
+    struct {
+      term_pos_t pos;
+      bool visible;
+    } cursor;
+    struct {
+      cursor_shape_t shape;
+      bool blink;
+    } cursor_shape;
+  };
+} render_event_t;
+
+// Moves made by the terminal since changes were last handed over, which are applied to the snapshot
+// and queued along with the damage. The whole screen is handed over instead if there are more.
+#define MAX_PENDING_MOVES 16
+static struct {
+  term_rect_t dest, src;
+} pending_moves[MAX_PENDING_MOVES];
+static int n_pending_moves = 0;
+static bool pending_moves_overflowed = false;
+
+// Room for one batch of changes, so that the queue never fills when the renderer runs on the same
+// core: the moves, a damaged span per row and both a cursor and a cursor shape change.
+#define RENDER_QUEUE_SIZE 64
+_Static_assert(MAX_PENDING_MOVES + (MAX_SCREEN_HEIGHT / MIN_CELL_HEIGHT) + 2 <= RENDER_QUEUE_SIZE,
+               "render queue too small for a batch of changes");
+static spsc_queue_t render_queue;
+
+// Scratch space for one row of cells read from the terminal and passed to the renderer.
+term_cell_t *row_term_cells = NULL;
+gfx_cell_t *row_cells = NULL;
 
 // Font handling
-gfx_font_t *current_font;
+gfx_font_t *current_font = NULL;
 
-// Frame buffer and frame counter (used for blinking text).
-uint8_t *frame_buffer = NULL;
-uint32_t frame_counter = 0;
+// The mode last set by set_mode().
+videoout_mode_t *current_mode = NULL;
 
-static void vblank_callback() { frame_counter++; }
+// A frame buffer along with the state of what has been drawn into it.
+typedef struct {
+  uint8_t *pixels;
+
+  // Frame buffer row holding the first line. Changed to scroll the contents.
+  int origin;
+} frame_buffer_t;
+
+// Frame buffers. Drawing happens in frame_buffers[back_buffer]. When double buffered the other
+// buffer is the one being shown, otherwise frame_buffers[0] is both drawn into and shown.
+frame_buffer_t frame_buffers[2];
+int back_buffer = 0;
+bool double_buffered = false;
+
+// Damage and scroll, in text rows, drawn into the front buffer which the back buffer has not seen
+// yet and rows scrolled since the last redraw. Damage is kept in current terminal coordinates.
+damage_t carried_damage;
+int carried_scroll = 0, frame_scroll = 0;
+
+// Snapshot seq as of which the renderer had drawn everything handed to it, and presented it when
+// double buffered, or ~0u, which seq never is, while anything is left. See firmware_is_idle().
+static atomic_uint drawn_seq = ~0u;
+
+// Cleared while core 0 parses input and set once the changes have been handed to the renderer.
+static atomic_bool input_published = true;
+
+// Frame counter (used for frame pacing).
+volatile uint32_t frame_counter = 0;
+
+// Time of the most recent vblank and the time between the last two.
+volatile uint32_t vblank_time_us = 0, frame_period_us = 0;
+
+// Pacing of parsing against the display. While input keeps arriving it is parsed in chunks of up to
+// parse_chunk_size bytes until publish_lead_us before the next vblank, and only then handed to the
+// renderer. The renderer then draws once per frame, starting ahead of the beam at the top of the
+// screen, rather than drawing states which are never shown. Input arriving after a pause is handed
+// over as soon as it is parsed. Change with OSC 7771, see set_settings_from_osc().
+typedef struct {
+  uint32_t publish_lead_us;
+  uint32_t parse_chunk_size;
+} frame_pacing_config_t;
+
+frame_pacing_config_t frame_pacing_config = {
+    .publish_lead_us = 1000,
+    .parse_chunk_size = 256,
+};
+
+// Counts kept by the frame pacing, for inspection from the debugger. A frame is skipped if input was
+// parsed throughout it without the changes being handed over by its deadline.
+typedef struct {
+  uint32_t frames_rendered; // frames in which the renderer drew anything
+  uint32_t frames_skipped;
+  uint32_t bytes_last_frame, bytes_max_frame; // bytes parsed in a frame
+  uint32_t draw_us_last, draw_us_max;         // time taken to draw the damage, when there was any
+} frame_stats_t;
+
+frame_stats_t frame_stats;
+
+// Character cells used in place of the frame buffer in text mode.
+gfx_text_cell_t *text_cells = NULL;
+
+static void __not_in_flash_func(vblank_callback)() {
+  uint32_t now = time_us_32();
+  frame_period_us = now - vblank_time_us;
+  vblank_time_us = now;
+  frame_counter++;
+}
+
+static void __not_in_flash_func(text_line_renderer)(uint line, void *buffer) {
+  gfx_text_render_line(line, buffer, videoout_get_screen_stride());
+}
 
 static uint8_t codepoint_to_ch(uint32_t cp) {
-  if ((cp >= 0x20) && (cp < 0x7f)) {
-    return cp;
-  }
-  uint16_t *map_row = cp437_map[cp & 0xff];
-  for (int i = 0; i < CP437_ENTRY_LEN; i++) {
-    uint16_t entry = map_row[i];
-    if ((entry >> 8) == (cp >> 8)) {
-      return entry & 0xff;
-    }
+  if (cp > 0xffff) {
+    // The right half of a wide character, which is left blank, or outside the BMP.
+    return (cp == (uint32_t)-1) ? 0 : CP437_UNMAPPED;
   }
-  return 0;
+  return cp437_pages[cp437_page_index[cp >> 8]][cp & 0xff];
 }
 
+// Weights, summing to 256, used to take the luminance of an RGB colour and the luminances at which
+// it is shown dim and bright rather than black. The defaults are the cheap (r + 2g + b) / 4; Rec.
+// 709 would be weights of {54, 183, 19}. Change with OSC 7771, see set_settings_from_osc().
+typedef struct {
+  uint16_t red_weight, green_weight, blue_weight;
+  uint8_t dim_threshold, bright_threshold;
+} luminance_config_t;
+
+luminance_config_t luminance_config = {
+    .red_weight = 64,
+    .green_weight = 128,
+    .blue_weight = 64,
+    .dim_threshold = 85,
+    .bright_threshold = 171,
+};
+
+// Pixel value for each indexed colour, filled in as colours are used. PX_UNKNOWN marks an entry not
+// looked up since the palette, default colours or luminance config last changed.
+#define PX_UNKNOWN 0xff
+static uint8_t indexed_px[256];
+
+// Small direct-mapped cache of pixel values for RGB colours. Entries hold the colour with bit 24
+// set so a zeroed entry never matches.
+#define RGB_CACHE_SIZE 16
+#define RGB_CACHE_VALID (1u << 24)
+static struct {
+  uint32_t rgb;
+  uint8_t px;
+} rgb_cache[RGB_CACHE_SIZE];
+
+// ANSI colours replaced with OSC 4, which are then shown by luminance rather than indexed_to_px().
+static uint16_t palette_overridden = 0;
+
 static int rgb_to_px(uint8_t r, uint8_t g, uint8_t b) {
-  uint32_t lum = 0;
-#if 0
-  lum += (uint32_t)(0.2126 * (1 << 16)) * (uint32_t)r;
-  lum += (uint32_t)(0.7152 * (1 << 16)) * (uint32_t)g;
-  lum += (uint32_t)(0.0722 * (1 << 16)) * (uint32_t)b;
-  lum >>= 16;
-#else
-  lum += r;
-  lum += ((uint32_t)g) << 1;
-  lum += b;
-  lum >>= 2;
-#endif
+  uint32_t lum = (luminance_config.red_weight * (uint32_t)r +
+                  luminance_config.green_weight * (uint32_t)g +
+                  luminance_config.blue_weight * (uint32_t)b) >>
+                 8;
 
-  if (lum < 85) {
+  if (lum < luminance_config.dim_threshold) {
     return 0;
-  } else if (lum < 171) {
+  } else if (lum < luminance_config.bright_threshold) {
     return 2;
   } else {
     return 3;
@@ -80,168 +310,946 @@ static int indexed_to_px(uint8_t idx) {
   return 3;
 }
 
-static uint8_t color_to_px(VTermColor *color) {
-  if (VTERM_COLOR_IS_INDEXED(color) && (color->indexed.idx < 16)) {
-    return indexed_to_px(color->indexed.idx);
+static uint8_t color_to_px(const term_color_t *color) {
+  if (color->type == TERM_COLOR_INDEXED) {
+    uint8_t idx = color->idx;
+    if (indexed_px[idx] == PX_UNKNOWN) {
+      if ((idx < 16) && !(palette_overridden & (1u << idx))) {
+        indexed_px[idx] = indexed_to_px(idx);
+      } else {
+        term_color_t rgb = *color;
+        term_color_to_rgb(&rgb);
+        indexed_px[idx] = rgb_to_px(rgb.red, rgb.green, rgb.blue);
+      }
+    }
+    return indexed_px[idx];
+  }
+
+  uint32_t rgb = RGB_CACHE_VALID | ((uint32_t)color->red << 16) | ((uint32_t)color->green << 8) |
+                 color->blue;
+  int slot = ((rgb * 2654435761u) >> 28) & (RGB_CACHE_SIZE - 1);
+  if (rgb_cache[slot].rgb != rgb) {
+    rgb_cache[slot].rgb = rgb;
+    rgb_cache[slot].px = rgb_to_px(color->red, color->green, color->blue);
   }
-  vterm_screen_convert_color_to_rgb(term_screen, color);
-  return rgb_to_px(color->rgb.red, color->rgb.green, color->rgb.blue);
+  return rgb_cache[slot].px;
 }
 
-static void term_output_cb(const char *s, size_t len, void *user) { fwrite(s, 1, len, stdout); }
+// Forget cached pixel values and redraw everything in the new colours.
+static void invalidate_palette(void) {
+  memset(indexed_px, PX_UNKNOWN, sizeof(indexed_px));
+  memset(rgb_cache, 0x00, sizeof(rgb_cache));
+  damage_all(&input_damage);
+}
 
-static void redraw_term(void) {
-  int n_rows, n_cols;
-  VTermPos pos;
-  VTermScreenCell cell;
+static void set_luminance_config(const luminance_config_t *config) {
+  luminance_config = *config;
+  invalidate_palette();
+}
+
+static void set_frame_pacing_config(const frame_pacing_config_t *config) {
+  frame_pacing_config = *config;
+}
+
+static void set_default_colors(const term_color_t *fg, const term_color_t *bg) {
+  term_set_default_colors(fg, bg);
+  invalidate_palette();
+}
+
+// Parse an X11 colour spec as used by OSC 4, either rgb:r/g/b with 1 to 4 hex digits per component
+// or #rrggbb. Returns false for anything else, including the "?" query.
+static bool parse_color_spec(const char *spec, term_color_t *color) {
+  uint8_t c[3];
+  if (strncmp(spec, "rgb:", 4) == 0) {
+    const char *p = spec + 4;
+    for (int i = 0; i < 3; ++i) {
+      char *end;
+      unsigned long v = strtoul(p, &end, 16);
+      int n_digits = end - p;
+      if ((n_digits < 1) || (n_digits > 4) || (*end != ((i < 2) ? '/' : '\0'))) {
+        return false;
+      }
+      // Scale to 8 bits, e.g. f -> ff and fff0 -> ff.
+      c[i] = (v * 255) / ((1ul << (4 * n_digits)) - 1);
+      p = end + 1;
+    }
+  } else if ((spec[0] == '#') && (strlen(spec) == 7)) {
+    char *end;
+    unsigned long v = strtoul(spec + 1, &end, 16);
+    if (*end != '\0') {
+      return false;
+    }
+    c[0] = v >> 16;
+    c[1] = v >> 8;
+    c[2] = v;
+  } else {
+    return false;
+  }
+  *color = (term_color_t){.type = TERM_COLOR_RGB, .red = c[0], .green = c[1], .blue = c[2]};
+  return true;
+}
+
+static void term_output(const char *bytes, size_t len) { fwrite(bytes, 1, len, stdout); }
+
+// OSC 7770 ST asks for the video pipeline and frame pacing counters, which are replied as
+// OSC 7770 ; name=value [; name=value ...] ST. Only backends which pass on OSCs they do not handle
+// support it.
+#define STATS_OSC 7770
+
+static void send_stats(void) {
+  videoout_stats_t v;
+  videoout_get_stats(&v);
+  char reply[384];
+  int len = snprintf(
+      reply, sizeof(reply),
+      "\033]%d;frames=%" PRIu32 ";missed_frames=%" PRIu32 ";late_fields=%" PRIu32
+      ";video_underflows=%" PRIu32 ";sync_underflows=%" PRIu32 ";latency_us=%" PRIu32 "/%" PRIu32
+      "/%" PRIu32 ";frames_rendered=%" PRIu32 ";frames_skipped=%" PRIu32
+      ";bytes_last_frame=%" PRIu32 ";bytes_max_frame=%" PRIu32 ";draw_us=%" PRIu32 "/%" PRIu32
+      "\033\\",
+      STATS_OSC, v.frames, v.missed_frames, v.late_fields, v.video_underflows, v.sync_underflows,
+      v.latency_min_us, v.latency_avg_us, v.latency_max_us, frame_stats.frames_rendered,
+      frame_stats.frames_skipped, frame_stats.bytes_last_frame, frame_stats.bytes_max_frame,
+      frame_stats.draw_us_last, frame_stats.draw_us_max);
+  if ((len > 0) && ((size_t)len < sizeof(reply))) {
+    term_output(reply, len);
+  }
+}
+
+// OSC 7771 ; name=value [; name=value ...] ST changes settings at runtime. Only backends which pass
+// on OSCs they do not handle support it.
+#define SETTINGS_OSC 7771
+
+// Parse a decimal setting value of at most max. Returns false for anything else.
+static bool parse_setting(const char *str, uint32_t max, uint32_t *value) {
+  char *end;
+  unsigned long v = strtoul(str, &end, 10);
+  if ((end == str) || (*end != '\0') || (v > max)) {
+    return false;
+  }
+  *value = v;
+  return true;
+}
+
+// Settings are red_weight, green_weight and blue_weight, which must sum to 256, and dim_threshold
+// and bright_threshold of luminance_config, and publish_lead_us, of up to a second, and
+// parse_chunk_size, from 1 to the input buffer size, of frame_pacing_config. The whole OSC is ignored
+// if any setting is unknown or out of range.
+static void set_settings_from_osc(char *s) {
+  luminance_config_t luminance = luminance_config;
+  frame_pacing_config_t pacing = frame_pacing_config;
+  char *save = NULL;
+  for (char *setting = strtok_r(s, ";", &save); setting != NULL;
+       setting = strtok_r(NULL, ";", &save)) {
+    char *value = strchr(setting, '=');
+    if (value == NULL) {
+      return;
+    }
+    *value++ = '\0';
+    uint32_t v;
+    if ((strcmp(setting, "red_weight") == 0) && parse_setting(value, 256, &v)) {
+      luminance.red_weight = v;
+    } else if ((strcmp(setting, "green_weight") == 0) && parse_setting(value, 256, &v)) {
+      luminance.green_weight = v;
+    } else if ((strcmp(setting, "blue_weight") == 0) && parse_setting(value, 256, &v)) {
+      luminance.blue_weight = v;
+    } else if ((strcmp(setting, "dim_threshold") == 0) && parse_setting(value, 255, &v)) {
+      luminance.dim_threshold = v;
+    } else if ((strcmp(setting, "bright_threshold") == 0) && parse_setting(value, 255, &v)) {
+      luminance.bright_threshold = v;
+    } else if ((strcmp(setting, "publish_lead_us") == 0) && parse_setting(value, 1000000, &v)) {
+      pacing.publish_lead_us = v;
+    } else if ((strcmp(setting, "parse_chunk_size") == 0) &&
+               parse_setting(value, INPUT_BUFFER_SIZE, &v) && (v > 0)) {
+      pacing.parse_chunk_size = v;
+    } else {
+      return;
+    }
+  }
+  if ((luminance.red_weight + luminance.green_weight + luminance.blue_weight != 256) ||
+      (luminance.dim_threshold > luminance.bright_threshold)) {
+    return;
+  }
+  if (memcmp(&luminance, &luminance_config, sizeof(luminance)) != 0) {
+    set_luminance_config(&luminance);
+  }
+  set_frame_pacing_config(&pacing);
+}
+
+// OSC 4 ; index ; spec [; index ; spec ...] sets palette colours. Only backends which pass on OSCs
+// they do not handle and have a settable palette support it.
+static char osc_buf[128];
+static size_t osc_len = 0;
+
+static void set_palette_from_osc(char *s) {
+  bool changed = false;
+  char *save = NULL;
+  char *idx_str = strtok_r(s, ";", &save);
+  while (idx_str != NULL) {
+    char *spec = strtok_r(NULL, ";", &save);
+    if (spec == NULL) {
+      break;
+    }
+    char *end;
+    long idx = strtol(idx_str, &end, 10);
+    term_color_t color;
+    if ((*end == '\0') && (idx >= 0) && (idx < 16) && parse_color_spec(spec, &color) &&
+        term_set_palette_color(idx, &color)) {
+      palette_overridden |= 1u << idx;
+      changed = true;
+    }
+    idx_str = strtok_r(NULL, ";", &save);
+  }
+  if (changed) {
+    invalidate_palette();
+  }
+}
+
+// OSC 7772 ; n ST scrolls the view n lines back into the scrollback, or forward if n is negative.
+// Further input returns the view to the live screen. Only backends with scrollback (libtsm) support
+// it.
+#define SCROLL_VIEW_OSC 7772
+
+static void scroll_view_from_osc(const char *s) {
+  char *end;
+  long n = strtol(s, &end, 10);
+  if ((end != s) && (*end == '\0') && (n >= -TERM_SCROLLBACK_LINES) &&
+      (n <= TERM_SCROLLBACK_LINES)) {
+    term_scroll_view(n);
+  }
+}
+
+static void term_osc(int command, const char *str, size_t len, bool initial, bool final) {
+  if ((command == STATS_OSC) && final) {
+    send_stats();
+    return;
+  }
+  if ((command != 4) && (command != SETTINGS_OSC) && (command != SCROLL_VIEW_OSC)) {
+    return;
+  }
+  if (initial) {
+    osc_len = 0;
+  }
+  size_t n = len;
+  if (n > sizeof(osc_buf) - 1 - osc_len) {
+    n = sizeof(osc_buf) - 1 - osc_len;
+  }
+  memcpy(osc_buf + osc_len, str, n);
+  osc_len += n;
+  if (final) {
+    osc_buf[osc_len] = '\0';
+    if (command == 4) {
+      set_palette_from_osc(osc_buf);
+    } else if (command == SETTINGS_OSC) {
+      set_settings_from_osc(osc_buf);
+    } else {
+      scroll_view_from_osc(osc_buf);
+    }
+  }
+}
+
+// Resolve columns start_col to end_col of a terminal row into the glyphs and pixel values used to
+// draw them.
+static void term_row_to_gfx(int row, int start_col, int end_col, gfx_cell_t *out) {
+  term_get_row(row, start_col, end_col, row_term_cells);
+
+  for (int col = start_col; col < end_col; ++col, ++out) {
+    term_cell_t *cell = &row_term_cells[col - start_col];
+    uint8_t fg = color_to_px(&cell->fg), bg = color_to_px(&cell->bg);
+
+    out->c = codepoint_to_ch(cell->ch);
+    out->active_v = cell->reverse ? bg : fg;
+    out->inactive_v = cell->reverse ? fg : bg;
+  }
+}
+
+// Return true if moving src to dest scrolls the whole screen vertically.
+static bool is_screen_scroll(term_rect_t dest, term_rect_t src, int n_rows, int n_cols) {
+  int top = (dest.start_row < src.start_row) ? dest.start_row : src.start_row;
+  int bottom = (dest.end_row > src.end_row) ? dest.end_row : src.end_row;
+  return (dest.start_col == 0) && (dest.end_col == n_cols) && (src.start_col == 0) &&
+         (src.end_col == n_cols) && (top == 0) && (bottom == n_rows);
+}
+
+static gfx_cell_t *snapshot_row(int row) {
+  return &snapshot.cells[((snapshot.origin + row) % snapshot.n_rows) * snapshot.n_cols];
+}
+
+static void snapshot_move(term_rect_t dest, term_rect_t src) {
+  if (is_screen_scroll(dest, src, snapshot.n_rows, snapshot.n_cols)) {
+    int origin = (snapshot.origin + src.start_row - dest.start_row) % snapshot.n_rows;
+    snapshot.origin = (origin < 0) ? origin + snapshot.n_rows : origin;
+    return;
+  }
+
+  // Work away from the overlap so that no source row is read after it was written.
+  int n_rows = src.end_row - src.start_row;
+  size_t size = sizeof(snapshot.cells[0]) * (src.end_col - src.start_col);
+  for (int i = 0; i < n_rows; ++i) {
+    int offset = (dest.start_row <= src.start_row) ? i : n_rows - 1 - i;
+    memmove(snapshot_row(dest.start_row + offset) + dest.start_col,
+            snapshot_row(src.start_row + offset) + src.start_col, size);
+  }
+}
+
+static void write_snapshot_begin(void) {
+  uint32_t seq = atomic_load_explicit(&snapshot.seq, memory_order_relaxed);
+  atomic_store_explicit(&snapshot.seq, seq + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+}
+
+static void write_snapshot_end(void) {
+  uint32_t seq = atomic_load_explicit(&snapshot.seq, memory_order_relaxed);
+  atomic_store_explicit(&snapshot.seq, seq + 1, memory_order_release);
+}
+
+// Hand the changes made by the terminal since the last call to the renderer. Moves are applied to
+// the snapshot and damaged cells resolved into it, and both are queued for the renderer along with
+// any cursor change.
+static void publish_changes(void) {
+  // Damage and moves may be held back by the backend until flushed.
+  term_flush_damage();
+
+  if (pending_moves_overflowed) {
+    n_pending_moves = 0;
+    pending_moves_overflowed = false;
+    damage_all(&input_damage);
+  }
+
+  // Writing the snapshot would only make the renderer redo any reads it has in progress, and the
+  // event sent would wake this core from its next wait.
+  if ((n_pending_moves == 0) && damage_is_clear(&input_damage) && !input_cursor_changed &&
+      !input_cursor_shape_changed) {
+    return;
+  }
+
+  write_snapshot_begin();
+
+  for (int i = 0; i < n_pending_moves; ++i) {
+    snapshot_move(pending_moves[i].dest, pending_moves[i].src);
+    render_event_t event = {.type = RENDER_EVENT_MOVE,
+                            .move = {.dest = pending_moves[i].dest, .src = pending_moves[i].src}};
+    spsc_queue_push(&render_queue, &event);
+  }
+  n_pending_moves = 0;
+
+  for (int row = 0; row < input_damage.n_rows; ++row) {
+    if (!damage_row_is_damaged(&input_damage, row)) {
+      continue;
+    }
+    int start_col = input_damage.spans[row].start_col, end_col = input_damage.spans[row].end_col;
+    term_row_to_gfx(row, start_col, end_col, snapshot_row(row) + start_col);
+    render_event_t event = {
+        .type = RENDER_EVENT_DAMAGE,
+        .rect = {.start_row = row, .end_row = row + 1, .start_col = start_col, .end_col = end_col}};
+    spsc_queue_push(&render_queue, &event);
+  }
+  damage_clear(&input_damage);
+
+  if (input_cursor_changed) {
+    render_event_t event = {.type = RENDER_EVENT_CURSOR,
+                            .cursor = {.pos = input_cursor_pos, .visible = input_cursor_visible}};
+    spsc_queue_push(&render_queue, &event);
+    input_cursor_changed = false;
+  }
+
+  if (input_cursor_shape_changed) {
+    render_event_t event = {
+        .type = RENDER_EVENT_CURSOR_SHAPE,
+        .cursor_shape = {.shape = input_cursor_shape, .blink = input_cursor_blink}};
+    spsc_queue_push(&render_queue, &event);
+    input_cursor_shape_changed = false;
+  }
+
+  write_snapshot_end();
+
+  if (DUAL_CORE) {
+    __sev();
+  }
+}
+
+// Copy columns start_col to end_col of a row from the snapshot. Return false if the snapshot changed
+// after seq was read, in which case the copy must not be drawn.
+static bool snapshot_row_to_gfx(int row, int start_col, int end_col, gfx_cell_t *out,
+                                uint32_t seq) {
+  memcpy(out, snapshot_row(row) + start_col, sizeof(out[0]) * (end_col - start_col));
+  atomic_thread_fence(memory_order_acquire);
+  return atomic_load_explicit(&snapshot.seq, memory_order_relaxed) == seq;
+}
+
+// Rotate the contents of a frame buffer up by n text rows, or down if n is negative, by changing
+// which frame buffer row holds the first line rather than by moving pixels.
+static void rotate_frame_buffer(frame_buffer_t *fb, int n) {
+  int cell_height = gfx_font_get_cell_height(current_font);
+  int height = videoout_get_screen_height();
+
+  int origin = (fb->origin + (n * cell_height)) % height;
+  fb->origin = (origin < 0) ? origin + height : origin;
+}
+
+// Scroll the frame buffer contents up by n text rows, or down if n is negative.
+static void scroll_frame_buffer(int n, int n_rows, int n_cols) {
+  // Pending damage moves with the contents.
+  damage_scroll(&line_damage, 0, n_rows, n);
+  if (double_buffered) {
+    damage_scroll(&carried_damage, 0, n_rows, n);
+  }
+
+  rotate_frame_buffer(&frame_buffers[back_buffer], n);
+  frame_scroll += n;
+}
+
+// Move what has been drawn of the terminal's contents in src to dest.
+static void move_rect(term_rect_t dest, term_rect_t src) {
+  int n_rows = line_damage.n_rows, n_cols = line_damage.n_cols;
+  int cell_height = gfx_font_get_cell_height(current_font);
+  int cell_width = gfx_font_get_cell_width(current_font);
+  frame_buffer_t *fb = &frame_buffers[back_buffer];
+
+  // Vertical scrolls of the whole screen are done by rotating the frame buffer.
+  if (!TEXT_MODE && is_screen_scroll(dest, src, n_rows, n_cols)) {
+    scroll_frame_buffer(src.start_row - dest.start_row, n_rows, n_cols);
+    return;
+  }
+
+  // Anything else is moved in place.
+  int move_rows = src.end_row - src.start_row, move_cols = src.end_col - src.start_col;
+  if (TEXT_MODE) {
+    gfx_text_move_cells(dest.start_col, dest.start_row, src.start_col, src.start_row, move_cols,
+                        move_rows);
+  } else {
+    gfx_set_frame_buffer(fb->pixels, videoout_get_screen_stride());
+    gfx_set_frame_buffer_origin(fb->origin, videoout_get_screen_height());
+    gfx_move_rect(dest.start_col * cell_width, dest.start_row * cell_height,
+                  src.start_col * cell_width, src.start_row * cell_height, move_cols * cell_width,
+                  move_rows * cell_height);
+  }
+
+  // Pending damage moves with the contents.
+  damage_move_rect(&line_damage, dest.start_row, dest.start_col, src.start_row, src.start_col,
+                   move_rows, move_cols);
+}
+
+// Overlay the cursor on the output at the renderer's cursor position.
+static void show_cursor(void) {
+  int cell_height = gfx_font_get_cell_height(current_font);
+  int cell_width = gfx_font_get_cell_width(current_font);
+  if (!cursor_visible) {
+    videoout_set_cursor(0, 0, 0, 0);
+    return;
+  }
+
+  int x = cursor_pos.col * cell_width, y = cursor_pos.row * cell_height;
+  switch (cursor_shape) {
+  case CURSOR_SHAPE_BLOCK:
+    videoout_set_cursor(x, y, cell_width, cell_height);
+    break;
+  case CURSOR_SHAPE_UNDERLINE:
+    videoout_set_cursor(x, y + cell_height - 2, cell_width, 2);
+    break;
+  case CURSOR_SHAPE_BAR:
+    videoout_set_cursor(x, y, 2, cell_height);
+    break;
+  }
+}
+
+static void set_cursor_shape(cursor_shape_t shape, bool blink) {
+  cursor_shape = shape;
+  videoout_set_cursor_blink(blink ? CURSOR_BLINK_PERIOD : 0);
+  cursor_moved = true;
+}
+
+// Take the changes handed over by publish_changes().
+static void apply_render_events(void) {
+  render_event_t event;
+  while (spsc_queue_pop(&render_queue, &event)) {
+    switch (event.type) {
+    case RENDER_EVENT_DAMAGE:
+      damage_add_rect(&line_damage, event.rect.start_row, event.rect.end_row,
+                      event.rect.start_col, event.rect.end_col);
+      break;
+    case RENDER_EVENT_MOVE:
+      move_rect(event.move.dest, event.move.src);
+      break;
+    case RENDER_EVENT_CURSOR:
+      cursor_pos = event.cursor.pos;
+      cursor_visible = event.cursor.visible;
+      cursor_moved = true;
+      break;
+    case RENDER_EVENT_CURSOR_SHAPE:
+      set_cursor_shape(event.cursor_shape.shape, event.cursor_shape.blink);
+      break;
+    }
+  }
+}
+
+// Draw the damage, scrolling and cursor taken from the render queue, reading cells from the
+// snapshot as of seq.
+static void draw_changes(uint32_t seq) {
+  int n_rows = line_damage.n_rows;
   uint32_t cell_height = gfx_font_get_cell_height(current_font);
   uint32_t cell_width = gfx_font_get_cell_width(current_font);
-  static uint32_t prev_frame_counter = 0;
+  frame_buffer_t *fb = &frame_buffers[back_buffer];
 
-  bool should_redraw_cursor = cursor_moved && cursor_visible;
+  bool scrolled = (frame_scroll != 0), drew = false;
+  if (!TEXT_MODE) {
+    if (double_buffered) {
+      // The back buffer is shown until the previous present completes.
+      videoout_wait_for_present();
 
-  if ((frame_counter & 0xf) != (prev_frame_counter & 0xf)) {
-    should_redraw_cursor = cursor_visible;
+      // Bring the back buffer up to date with what was drawn into the front buffer.
+      if (carried_scroll != 0) {
+        rotate_frame_buffer(fb, carried_scroll);
+        scrolled = true;
+      }
+    }
+
+    gfx_set_frame_buffer(fb->pixels, videoout_get_screen_stride());
+    gfx_set_frame_buffer_origin(fb->origin, videoout_get_screen_height());
+
+    // Any lines below the last text row show rotated contents after a scroll and must be blanked.
+    if (scrolled && (n_rows * cell_height < videoout_get_screen_height())) {
+      gfx_fill_lines(n_rows * cell_height, videoout_get_screen_height() - (n_rows * cell_height),
+                     0);
+    }
   }
-  prev_frame_counter = frame_counter;
 
-  vterm_get_size(term, &n_rows, &n_cols);
+  // The damage drawn here has still to be drawn into the other buffer when double buffered. Merge
+  // in the damage carried from the other buffer only after noting this.
+  damage_t *damage = &line_damage;
+  if (double_buffered) {
+    damage_t tmp = carried_damage;
+    carried_damage = line_damage;
+    line_damage = tmp;
+    damage_merge(&line_damage, &carried_damage);
+  }
 
-  for (pos.col = 0; pos.col < n_cols; ++pos.col) {
-    uint32_t damage_mask = line_damages[pos.col];
-    if ((damage_mask == 0) && ((!should_redraw_cursor || (pos.col != cursor_pos.col)))) {
+  // Draw each damaged span in a single scanline-oriented pass. If the snapshot changes part way the
+  // rest is left damaged for the next pass, which first takes the changes.
+  uint32_t draw_start_us = time_us_32();
+  for (int row = 0; row < n_rows; ++row) {
+    if (!damage_row_is_damaged(damage, row)) {
       continue;
     }
 
-    for (pos.row = 0; pos.row < n_rows; ++pos.row) {
-      if (!(damage_mask & (1 << pos.row)) &&
-          (!should_redraw_cursor || (pos.row != cursor_pos.row))) {
-        continue;
-      }
+    int start_col = damage->spans[row].start_col, end_col = damage->spans[row].end_col;
+    if (!snapshot_row_to_gfx(row, start_col, end_col, row_cells, seq)) {
+      break;
+    }
+    damage_clear_row(damage, row);
 
-      vterm_screen_get_cell(term_screen, pos, &cell);
-      uint8_t c = codepoint_to_ch(cell.chars[0]);
-      uint8_t fg = color_to_px(&cell.fg), bg = color_to_px(&cell.bg);
-      bool reverse = false;
+    if (TEXT_MODE) {
+      gfx_text_set_cells(start_col, row, row_cells, end_col - start_col);
+    } else {
+      gfx_font_draw_row(current_font, start_col * cell_width, row * cell_height, row_cells,
+                        end_col - start_col, GFX_OP_SET);
+    }
+    drew = true;
+  }
 
-      if (cell.attrs.reverse) {
-        reverse = !reverse;
-      }
+  if (drew) {
+    frame_stats.draw_us_last = time_us_32() - draw_start_us;
+    if (frame_stats.draw_us_last > frame_stats.draw_us_max) {
+      frame_stats.draw_us_max = frame_stats.draw_us_last;
+    }
+  }
 
-      if (cursor_visible && (pos.col == cursor_pos.col) && (pos.row == cursor_pos.row)) {
-        if ((frame_counter >> 5) & 0x1) {
-          reverse = !reverse;
-        }
-      }
+  static uint32_t rendered_frame = 0;
+  if (drew && (frame_counter != rendered_frame)) {
+    rendered_frame = frame_counter;
+    frame_stats.frames_rendered++;
+  }
 
-      if (reverse) {
-        uint8_t tmp = fg;
-        fg = bg;
-        bg = tmp;
-      }
+  if (cursor_moved) {
+    show_cursor();
+    cursor_moved = false;
+  }
 
-      gfx_font_draw_char(current_font, pos.col * cell_width, pos.row * cell_height, c, fg, bg,
-                         GFX_OP_SET);
+  if (TEXT_MODE) {
+    return;
+  }
+
+  // Only show the drawing, and any rotation from scrolling, once the exposed rows have been drawn.
+  // There is no need to flip if nothing changed.
+  if (double_buffered) {
+    if (!drew && !scrolled) {
+      return;
     }
+    videoout_present(fb->pixels, fb->origin);
+    back_buffer ^= 1;
+    carried_scroll = frame_scroll;
+  } else {
+    videoout_set_scroll(fb->origin);
   }
+  frame_scroll = 0;
+}
 
-  for (pos.col = 0; pos.col < n_cols; ++pos.col) {
-    line_damages[pos.col] = 0;
+static void redraw_term(void) {
+  // Moves are handled first so any damage then lands on the moved contents. Nothing is drawn while
+  // the snapshot is being written, as it may already hold changes not yet taken.
+  uint32_t seq = atomic_load_explicit(&snapshot.seq, memory_order_acquire);
+  apply_render_events();
+  if (seq & 1) {
+    return;
   }
+  draw_changes(seq);
+
+  bool drawn = damage_is_clear(&line_damage) && (frame_scroll == 0) && !cursor_moved &&
+               (!double_buffered || (damage_is_clear(&carried_damage) && (carried_scroll == 0)));
+  atomic_store_explicit(&drawn_seq, drawn ? seq : ~0u, memory_order_release);
 }
 
-static int term_screen_damage(VTermRect rect, void *user) {
-  uint32_t line_damage_mask = 0;
-  for (int i = rect.start_row; i < rect.end_row; i++) {
-    line_damage_mask |= (1 << i);
+// Return true once everything received has been parsed and handed to the renderer and it has all
+// been drawn. A frame buffer presented may not be shown until the next field. Polled from another
+// thread by the host build to know when to exit.
+bool firmware_is_idle(void) {
+  if (!input_is_empty() || !atomic_load(&input_published)) {
+    return false;
   }
-  for (int i = rect.start_col; i < rect.end_col; i++) {
-    line_damages[i] |= line_damage_mask;
+  uint32_t seq = atomic_load_explicit(&snapshot.seq, memory_order_acquire);
+  return spsc_queue_is_empty(&render_queue) &&
+         (atomic_load_explicit(&drawn_seq, memory_order_acquire) == seq);
+}
+
+// Moves are handed to the renderer, with the damage made after them, by publish_changes().
+static bool term_move_rect(term_rect_t dest, term_rect_t src) {
+  int n_rows = input_damage.n_rows, n_cols = input_damage.n_cols;
+  bool scroll = is_screen_scroll(dest, src, n_rows, n_cols);
+
+  // Only whole screen scrolls are made in both buffers when double buffered, by rotating them.
+  // Return false for anything else to have the destination damaged instead.
+  if (!TEXT_MODE && double_buffered && !scroll) {
+    return false;
   }
-  return 1;
+
+  // Pending damage moves with the contents.
+  if (scroll) {
+    damage_scroll(&input_damage, 0, n_rows, src.start_row - dest.start_row);
+  } else {
+    damage_move_rect(&input_damage, dest.start_row, dest.start_col, src.start_row, src.start_col,
+                     src.end_row - src.start_row, src.end_col - src.start_col);
+  }
+
+  if (n_pending_moves < MAX_PENDING_MOVES) {
+    pending_moves[n_pending_moves].dest = dest;
+    pending_moves[n_pending_moves].src = src;
+    n_pending_moves++;
+  } else {
+    pending_moves_overflowed = true;
+  }
+  return true;
+}
+
+static void term_damage(term_rect_t rect) {
+  damage_add_rect(&input_damage, rect.start_row, rect.end_row, rect.start_col, rect.end_col);
 }
 
-static int term_screen_setttermprop(VTermProp prop, VTermValue *val, void *user) {
-  switch (prop) {
-  case VTERM_PROP_CURSORVISIBLE:
-    cursor_visible = !!val->boolean;
+static void term_set_cursor_visible(bool visible) {
+  input_cursor_visible = visible;
+  input_cursor_changed = true;
+}
+
+// The cursor is overlaid on the output rather than drawn so neither position needs damage.
+static void term_move_cursor(term_pos_t pos, term_pos_t old_pos, bool visible) {
+  input_cursor_pos = pos;
+  input_cursor_visible = visible;
+  input_cursor_changed = true;
+}
+
+static void term_set_cursor_shape(int shape, bool blink) {
+  switch (shape) {
+  case TERM_CURSOR_SHAPE_UNDERLINE:
+    input_cursor_shape = CURSOR_SHAPE_UNDERLINE;
+    break;
+  case TERM_CURSOR_SHAPE_BAR:
+    input_cursor_shape = CURSOR_SHAPE_BAR;
     break;
   default:
+    input_cursor_shape = CURSOR_SHAPE_BLOCK;
     break;
   }
-  return 1;
+  input_cursor_blink = blink;
+  input_cursor_shape_changed = true;
 }
 
-static int term_screen_movecursor(VTermPos pos, VTermPos oldpos, int visible, void *user) {
-  line_damages[oldpos.col] |= (1 << oldpos.row);
-  cursor_pos = pos;
-  cursor_visible = !!visible;
-  cursor_moved = true;
-  return 1;
-}
+// Reverse video and the bell are shown by videoout inverting its output, without redrawing.
+static void term_set_reverse(bool reverse) { videoout_set_reverse(reverse); }
+static void term_bell(void) { videoout_flash(VISUAL_BELL_FIELDS); }
 
-static VTermScreenCallbacks term_screen_cbs = {
-    .damage = term_screen_damage,
-    .movecursor = term_screen_movecursor,
-    .settermprop = term_screen_setttermprop,
+static const term_callbacks_t term_callbacks = {
+    .damage = term_damage,
+    .move_rect = term_move_rect,
+    .move_cursor = term_move_cursor,
+    .set_cursor_visible = term_set_cursor_visible,
+    .set_cursor_shape = term_set_cursor_shape,
+    .set_reverse = term_set_reverse,
+    .bell = term_bell,
+    .output = term_output,
+    .osc = term_osc,
 };
 
-static void set_font(gfx_font_t *font) {
+// Resize the damage tracked by the renderer and the terminal. Return false, leaving it at the
+// previous size with everything damaged, if the spans cannot be allocated.
+static bool resize_damage(int n_rows, int n_cols) {
+  damage_t *damages[] = {&line_damage, &carried_damage, &input_damage};
+  int prev_n_rows = line_damage.n_rows, prev_n_cols = line_damage.n_cols;
+  for (int i = 0; i < 3; ++i) {
+    if (!damage_resize(damages[i], n_rows, n_cols)) {
+      // Only growing can fail, so going back to the previous size cannot.
+      for (int j = 0; j < i; ++j) {
+        damage_resize(damages[j], prev_n_rows, prev_n_cols);
+      }
+      for (int j = 0; j < 3; ++j) {
+        damage_all(damages[j]);
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+// Grow the buffers holding a screen of cells and a row of cells to at least n_cells and n_cols.
+// Return false if one cannot be grown. Those which cannot are left as they were, so the screen size
+// in use still fits.
+static bool grow_cell_buffers(size_t n_cells, int n_cols) {
+  gfx_cell_t *cells = arena_realloc(snapshot.cells, sizeof(snapshot.cells[0]) * n_cells);
+  if (cells == NULL) {
+    return false;
+  }
+  snapshot.cells = cells;
+
+  term_cell_t *term_cells = arena_realloc(row_term_cells, sizeof(row_term_cells[0]) * n_cols);
+  if (term_cells == NULL) {
+    return false;
+  }
+  row_term_cells = term_cells;
+
+  cells = arena_realloc(row_cells, sizeof(row_cells[0]) * n_cols);
+  if (cells == NULL) {
+    return false;
+  }
+  row_cells = cells;
+
+  if (TEXT_MODE) {
+    // The line renderer must not read the cells while they may be moved. It has none until the
+    // first font is set.
+    gfx_set_text_buffer(current_font, NULL, 0, 0);
+    gfx_text_cell_t *new_text_cells = arena_realloc(text_cells, sizeof(text_cells[0]) * n_cells);
+    if (new_text_cells != NULL) {
+      text_cells = new_text_cells;
+    }
+    if (current_font != NULL) {
+      gfx_set_text_buffer(current_font, text_cells, snapshot.n_cols, snapshot.n_rows);
+    }
+    if (new_text_cells == NULL) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Only called before the renderer is started on core 1. Return false, leaving the font and the
+// terminal size unchanged, if the buffers for the new size cannot be allocated.
+static bool set_font(gfx_font_t *font) {
   int n_rows = videoout_get_screen_height() / gfx_font_get_cell_height(font);
   int n_cols = videoout_get_screen_width() / gfx_font_get_cell_width(font);
+  gfx_font_t *prev_font = current_font;
+
+  // Buffers are grown to fit both the previous and the new size, so that the previous size is kept
+  // whichever allocation fails.
+  size_t n_cells = (size_t)n_rows * n_cols;
+  size_t prev_n_cells = (size_t)snapshot.n_rows * snapshot.n_cols;
+  if (!grow_cell_buffers((n_cells > prev_n_cells) ? n_cells : prev_n_cells,
+                         (n_cols > snapshot.n_cols) ? n_cols : snapshot.n_cols) ||
+      (gfx_font_get_glyph_cache(font) == NULL)) {
+    return false;
+  }
+  if (!resize_damage(n_rows, n_cols)) {
+    if (font != prev_font) {
+      gfx_font_release_glyph_cache(font);
+    }
+    return false;
+  }
+
   current_font = font;
-  line_damages = realloc(line_damages, sizeof(line_damages[0]) * n_cols);
-  for (int c = 0; c < n_cols; ++c) {
-    line_damages[c] = (1 << n_rows) - 1;
+  snapshot.n_rows = n_rows;
+  snapshot.n_cols = n_cols;
+  snapshot.origin = 0;
+  n_pending_moves = 0;
+  if (TEXT_MODE) {
+    memset(text_cells, 0x00, sizeof(text_cells[0]) * n_cells);
+    gfx_set_text_buffer(font, text_cells, n_cols, n_rows);
+  }
+  if ((prev_font != NULL) && (prev_font != font)) {
+    gfx_font_release_glyph_cache(prev_font);
+  }
+  damage_all(&line_damage);
+  damage_all(&input_damage);
+  for (int i = 0; i < 2; ++i) {
+    frame_buffers[i].origin = 0;
+  }
+  carried_scroll = frame_scroll = 0;
+  cursor_moved = true;
+  term_set_size(n_rows, n_cols);
+  return true;
+}
+
+// Return false, leaving the previous mode and frame buffers unchanged, if the mode cannot be output
+// or its frame buffer cannot be allocated. Only called before the renderer is started on core 1.
+static bool set_mode(videoout_mode_t *mode) {
+  if (TEXT_MODE) {
+    if (!videoout_set_line_renderer(text_line_renderer) || !videoout_set_mode(mode)) {
+      return false;
+    }
+    current_mode = mode;
+    return true;
+  }
+
+  if (!videoout_set_mode(mode)) {
+    return false;
+  }
+  size_t frame_buffer_size = videoout_get_screen_stride() * videoout_get_screen_height();
+
+  // The second frame buffer is only given up if the first does not otherwise fit. Should it still
+  // not fit, the previous mode is kept single buffered.
+  uint8_t *pixels = arena_realloc(frame_buffers[0].pixels, frame_buffer_size);
+  if ((pixels == NULL) && (frame_buffers[1].pixels != NULL)) {
+    arena_free(frame_buffers[1].pixels);
+    frame_buffers[1].pixels = NULL;
+    pixels = arena_realloc(frame_buffers[0].pixels, frame_buffer_size);
+  }
+  if (pixels == NULL) {
+    if (current_mode != NULL) {
+      videoout_set_mode(current_mode);
+    }
+    if (double_buffered && (frame_buffers[1].pixels == NULL)) {
+      // What was shown may have been in the buffer given up.
+      double_buffered = false;
+      back_buffer = 0;
+      carried_scroll = 0;
+      damage_all(&line_damage);
+      videoout_set_frame_buffer(frame_buffers[0].pixels);
+      videoout_set_scroll(frame_buffers[0].origin);
+      gfx_set_frame_buffer(frame_buffers[0].pixels, videoout_get_screen_stride());
+      gfx_set_frame_buffer_origin(frame_buffers[0].origin, videoout_get_screen_height());
+    }
+    return false;
   }
-  vterm_set_size(term, n_rows, n_cols);
+  frame_buffers[0].pixels = pixels;
+
+  // Only double buffer if both buffers fit.
+  arena_free(frame_buffers[1].pixels);
+  frame_buffers[1].pixels = DOUBLE_BUFFER ? arena_alloc(frame_buffer_size) : NULL;
+  double_buffered = frame_buffers[1].pixels != NULL;
+  back_buffer = double_buffered ? 1 : 0;
+
+  for (int i = 0; i < (double_buffered ? 2 : 1); ++i) {
+    memset(frame_buffers[i].pixels, 0x00, frame_buffer_size);
+    frame_buffers[i].origin = 0;
+  }
+
+  videoout_set_frame_buffer(frame_buffers[0].pixels);
+  videoout_set_scroll(0);
+  gfx_set_frame_buffer(frame_buffers[back_buffer].pixels, videoout_get_screen_stride());
+  gfx_set_frame_buffer_origin(0, videoout_get_screen_height());
+  current_mode = mode;
+  return true;
 }
 
-static void set_mode(videoout_mode_t *mode) {
-  videoout_set_mode(mode);
-  frame_buffer = realloc(frame_buffer, videoout_get_screen_stride() * videoout_get_screen_height());
-  videoout_set_frame_buffer(frame_buffer);
-  gfx_set_frame_buffer(frame_buffer, videoout_get_screen_stride());
-  memset(frame_buffer, 0x00, videoout_get_screen_stride() * videoout_get_screen_height());
+// The renderer, woken by publish_changes() and at each vblank.
+static void core1_main(void) {
+  while (true) {
+    redraw_term();
+    if (spsc_queue_is_empty(&render_queue)) {
+      __wfe();
+    }
+  }
 }
 
 int main(void) {
+  arena_init(arena_memory, sizeof(arena_memory));
+  input_init(INPUT_BUFFER_SIZE);
   stdio_init_all();
+  spsc_queue_init(&render_queue, sizeof(render_event_t), RENDER_QUEUE_SIZE);
   videoout_init(pio0, VSYNC_GPIO, NOTDIM_GPIO);
 
-  set_mode(&videoout_mode_864_350);
+  // Fall back to the smallest standard mode should the preferred one be refused.
+  if (!set_mode(&videoout_mode_864_350)) {
+    set_mode(&videoout_mode_720_350);
+  }
 
-  term = vterm_new(80, 25);
-  vterm_output_set_callback(term, term_output_cb, NULL);
-  vterm_set_utf8(term, 1);
+  term_init(25, 80, &term_callbacks);
   set_font(&gfx_mda_8x14_font);
 
-  term_screen = vterm_obtain_screen(term);
-  vterm_color_rgb(&default_bg_color, 0, 0, 0);
-  vterm_color_rgb(&default_fg_color, 255, 255, 255);
-  vterm_screen_set_default_colors(term_screen, &default_fg_color, &default_bg_color);
-  vterm_screen_set_callbacks(term_screen, &term_screen_cbs, NULL);
-
-  term_state = vterm_obtain_state(term);
-  vterm_state_reset(term_state, 1);
+  term_color_t fg = {.type = TERM_COLOR_RGB, .red = 255, .green = 255, .blue = 255};
+  term_color_t bg = {.type = TERM_COLOR_RGB, .red = 0, .green = 0, .blue = 0};
+  set_default_colors(&fg, &bg);
 
+  videoout_set_cursor_blink(CURSOR_BLINK_PERIOD);
   videoout_set_vblank_callback(vblank_callback);
   videoout_start();
 
-  char buf[1024];
+  // Everything needed has been allocated. Anything further would be from the steady state.
+  arena_seal();
+
+  if (DUAL_CORE) {
+    multicore_launch_core1(core1_main);
+  }
+
+  // Frame whose deadline changes were last handed over at, or ~0 if input then ran out, and frame
+  // whose parsed bytes are being counted.
+  uint32_t deadline_frame = ~0u, counted_frame = frame_counter, frame_bytes = 0;
+
   while (true) {
-    redraw_term();
-    int i = 0;
-    for (i = 0; i < sizeof(buf); i++) {
-      int c = getchar_timeout_us(32000);
-      if (c == PICO_ERROR_TIMEOUT) {
-        break;
+    // Parse what has been received straight from the input buffer until it runs out or this frame's
+    // deadline passes.
+    const char *bytes;
+    size_t len;
+    bool deadline_passed = false;
+    while (!deadline_passed && ((len = input_peek(&bytes)) > 0)) {
+      if (len > frame_pacing_config.parse_chunk_size) {
+        len = frame_pacing_config.parse_chunk_size;
+      }
+      atomic_store(&input_published, false);
+      term_input_write(bytes, len);
+      input_consume(len);
+
+      if (frame_counter != counted_frame) {
+        frame_stats.bytes_last_frame = frame_bytes;
+        if (frame_bytes > frame_stats.bytes_max_frame) {
+          frame_stats.bytes_max_frame = frame_bytes;
+        }
+        counted_frame = frame_counter;
+        frame_bytes = 0;
       }
-      buf[i] = c;
+      frame_bytes += len;
+
+      uint32_t frame = frame_counter, since_vblank = time_us_32() - vblank_time_us;
+      deadline_passed =
+          (frame != deadline_frame) &&
+          (since_vblank + frame_pacing_config.publish_lead_us >= frame_period_us);
+      if (deadline_passed) {
+        if ((deadline_frame != ~0u) && (frame - deadline_frame > 1)) {
+          frame_stats.frames_skipped += frame - deadline_frame - 1;
+        }
+        deadline_frame = frame;
+      }
+    }
+    if (!deadline_passed) {
+      deadline_frame = ~0u;
+    }
+
+    publish_changes();
+    atomic_store(&input_published, true);
+    if (!DUAL_CORE) {
+      redraw_term();
+    }
+
+    // Sleep until more input is received or until vblank.
+    if (input_is_empty()) {
+      __wfe();
     }
-    vterm_input_write(term, buf, i);
   }
 
-  vterm_free(term);
   videoout_cleanup();
 }
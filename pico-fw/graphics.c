@@ -1,12 +1,32 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
 #include "graphics.h"
 
+// Drawing and line rendering run from RAM on the device, clear of flash cache misses. graphics.c
+// is also built on a host.
+#if PICO_ON_DEVICE
+#include "pico.h"
+#define GFX_IN_RAM(func) __not_in_flash_func(func)
+#else
+#define GFX_IN_RAM(func) func
+#endif
+
 #include "cga_8x8_font.h"
 #include "mda_8x14_font.h"
 #include "mda_9x14_font.h"
 
 struct gfx_font {
-  uint8_t *data;
+  const uint8_t *data;
   uint8_t cell_width, cell_height;
+
+  // Glyphs pre-expanded to the 2bpp frame buffer format. Each scanline of each glyph is one word
+  // with the left-most pixel in the two MSBs. Set pixels are 0b11 and unset pixels are 0b00 so that
+  // any foreground/background combination can be applied with a pair of masks. Built by
+  // gfx_font_get_glyph_cache() when the font is set, before anything is drawn with it, and freed
+  // by gfx_font_release_glyph_cache() when it is replaced.
+  uint32_t *glyph_cache;
 };
 
 gfx_font_t gfx_mda_9x14_font = {
@@ -30,16 +50,59 @@ gfx_font_t gfx_cga_8x8_font = {
 static uint8_t *gfx_frame_buffer;
 static uint32_t gfx_frame_buffer_stride;
 
+// Frame buffer row holding line 0 and the number of rows after which lines wrap around. The end
+// pointer is NULL if lines do not wrap.
+static uint32_t gfx_frame_buffer_origin, gfx_frame_buffer_height;
+static uint8_t *gfx_frame_buffer_end;
+
+static gfx_font_t *gfx_text_font;
+static gfx_text_cell_t *gfx_text_cells;
+static uint32_t gfx_text_n_cols, gfx_text_n_rows;
+
 void gfx_set_frame_buffer(uint8_t *frame_buffer, uint32_t stride) {
   gfx_frame_buffer = frame_buffer;
   gfx_frame_buffer_stride = stride;
+  gfx_set_frame_buffer_origin(0, 0);
+}
+
+void gfx_set_frame_buffer_origin(uint32_t origin, uint32_t height) {
+  gfx_frame_buffer_origin = (height != 0) ? (origin % height) : 0;
+  gfx_frame_buffer_height = height;
+  gfx_frame_buffer_end =
+      (height != 0) ? gfx_frame_buffer + (gfx_frame_buffer_stride * height) : NULL;
+}
+
+uint32_t gfx_get_frame_buffer_origin(void) { return gfx_frame_buffer_origin; }
+
+// Return the frame buffer row holding line y.
+static inline uint8_t *gfx_frame_buffer_row(uint32_t y) {
+  if (gfx_frame_buffer_height != 0) {
+    y += gfx_frame_buffer_origin;
+    if (y >= gfx_frame_buffer_height) {
+      y -= gfx_frame_buffer_height;
+    }
+  }
+  return gfx_frame_buffer + (gfx_frame_buffer_stride * y);
+}
+
+// Return the frame buffer row holding the line after the one in row.
+static inline uint8_t *gfx_next_frame_buffer_row(uint8_t *row) {
+  row += gfx_frame_buffer_stride;
+  return (row == gfx_frame_buffer_end) ? gfx_frame_buffer : row;
+}
+
+void GFX_IN_RAM(gfx_fill_lines)(uint32_t y, uint32_t n_lines, uint8_t v) {
+  uint8_t *row = gfx_frame_buffer_row(y);
+  for (uint32_t i = 0; i < n_lines; i++, row = gfx_next_frame_buffer_row(row)) {
+    memset(row, GFX_PIXEL_PATTERN(v) & 0xff, gfx_frame_buffer_stride);
+  }
 }
 
 uint8_t *gfx_get_frame_buffer(void) { return gfx_frame_buffer; }
 uint32_t gfx_get_frame_buffer_stride(void) { return gfx_frame_buffer_stride; }
 
 inline void gfx_update_pixel(uint32_t x, uint32_t y, uint8_t v, gfx_operation_t op) {
-  uint8_t *row = gfx_frame_buffer + (gfx_frame_buffer_stride * y);
+  uint8_t *row = gfx_frame_buffer_row(y);
   uint32_t byte_idx = x >> 2;
   uint32_t px_idx = x & 0x3;
 
@@ -66,23 +129,311 @@ inline void gfx_update_pixel(uint32_t x, uint32_t y, uint8_t v, gfx_operation_t
 uint8_t gfx_font_get_cell_width(gfx_font_t *font) { return font->cell_width; }
 uint8_t gfx_font_get_cell_height(gfx_font_t *font) { return font->cell_height; }
 
-void gfx_font_draw_char(gfx_font_t *font, uint32_t x, uint32_t y, uint8_t c, uint8_t active_v,
-                        uint8_t inactive_v, gfx_operation_t op) {
-
+// Expand every glyph of the font into the 2bpp glyph cache.
+static void gfx_font_fill_glyph_cache(gfx_font_t *font) {
   uint8_t cell_height = font->cell_height, cell_width = font->cell_width;
   uint32_t matrix_stride = cell_width << 1; // bytes
-  uint32_t start_bit = (c & 0xf) * cell_width;
-  uint8_t *matrix_row = font->data + (cell_height * (c >> 4) * matrix_stride);
-  uint8_t *fb_row = gfx_frame_buffer + (gfx_frame_buffer_stride * y);
-  for (int cy = 0; cy < cell_height;
-       cy++, matrix_row += matrix_stride, fb_row += gfx_frame_buffer_stride) {
-    uint8_t cell_data = matrix_row[start_bit >> 3];
-    for (int cx = 0, bit = start_bit; cx < cell_width; cx++, bit++) {
-      if ((cx != 0) && ((bit & 0x7) == 0)) {
-        cell_data = matrix_row[bit >> 3];
+  uint32_t *cache_row = font->glyph_cache;
+
+  for (int c = 0; c < 256; c++) {
+    uint32_t start_bit = (c & 0xf) * cell_width;
+    const uint8_t *matrix_row = font->data + (cell_height * (c >> 4) * matrix_stride);
+    for (int cy = 0; cy < cell_height; cy++, matrix_row += matrix_stride, cache_row++) {
+      uint32_t expanded = 0;
+      for (int cx = 0, bit = start_bit; cx < cell_width; cx++, bit++) {
+        if ((matrix_row[bit >> 3] >> (7 - (bit & 0x7))) & 0x1) {
+          expanded |= 0xc0000000 >> (cx << 1);
+        }
       }
-      uint8_t char_cell_px = (cell_data >> (7 - (bit & 0x7))) & 0x1;
-      gfx_update_pixel(x + cx, y + cy, char_cell_px ? active_v : inactive_v, op);
+      *cache_row = expanded;
+    }
+  }
+}
+
+const uint32_t *gfx_font_get_glyph_cache(gfx_font_t *font) {
+  if (font->glyph_cache == NULL) {
+    font->glyph_cache = arena_alloc(sizeof(font->glyph_cache[0]) * 256 * font->cell_height);
+    if (font->glyph_cache == NULL) {
+      return NULL;
+    }
+    gfx_font_fill_glyph_cache(font);
+  }
+  return font->glyph_cache;
+}
+
+void gfx_font_release_glyph_cache(gfx_font_t *font) {
+  arena_free(font->glyph_cache);
+  font->glyph_cache = NULL;
+}
+
+// Store the bits of v selected by mask into the frame buffer byte at p.
+static inline void gfx_store_byte(uint8_t *p, uint8_t v, uint8_t mask, gfx_operation_t op) {
+  v &= mask;
+  switch (op) {
+  case GFX_OP_SET:
+    *p = (mask == 0xff) ? v : ((*p & ~mask) | v);
+    break;
+  case GFX_OP_XOR:
+    *p ^= v;
+    break;
+  case GFX_OP_AND:
+    *p &= v | ~mask;
+    break;
+  }
+}
+
+void GFX_IN_RAM(gfx_blit_bits)(uint8_t *fb_row, uint32_t x, uint32_t v, uint32_t mask,
+                               gfx_operation_t op) {
+  uint8_t *p = fb_row + (x >> 2);
+  uint32_t shift = (x & 0x3) << 1;
+
+  // Only shift when the span does not start on a byte (4 pixel) boundary.
+  if (shift != 0) {
+    v >>= shift;
+    mask >>= shift;
+  }
+
+  for (; mask != 0; mask <<= 8, v <<= 8, p++) {
+    gfx_store_byte(p, v >> 24, mask >> 24, op);
+  }
+}
+
+// Return n pixels, at most 16, starting at pixel x of a frame buffer row held MSB-first in a word.
+// Only the bytes holding those pixels are read.
+static inline uint32_t gfx_read_bits(const uint8_t *fb_row, uint32_t x, uint32_t n) {
+  const uint8_t *p = fb_row + (x >> 2);
+  uint32_t n_bytes = ((x & 0x3) + n + 3) >> 2;
+  uint64_t v = 0;
+  for (uint32_t i = 0; i < n_bytes; i++) {
+    v |= (uint64_t)p[i] << (56 - (i << 3));
+  }
+  return (v << ((x & 0x3) << 1)) >> 32;
+}
+
+// Number of pixels moved at a time when source and destination are not aligned alike. Any start
+// pixel within a byte plus this must fit in the 16 pixels gfx_blit_bits() can shift.
+#define GFX_MOVE_CHUNK 12
+
+// Copy width pixels from pixel src_x of src_row to pixel dst_x of dst_row. The rows may be the same
+// row with overlapping spans.
+static void GFX_IN_RAM(gfx_move_pixels)(uint8_t *dst_row, uint32_t dst_x,
+                                        const uint8_t *src_row, uint32_t src_x, uint32_t width) {
+  if (((dst_x ^ src_x) & 0x3) == 0) {
+    // Whole bytes in the middle are moved directly. Both partial ends are read before anything is
+    // written so that an overlapping move cannot clobber them.
+    uint32_t head = (4 - (dst_x & 0x3)) & 0x3;
+    head = (head > width) ? width : head;
+    uint32_t tail = (width - head) & 0x3;
+    uint32_t head_v = (head != 0) ? gfx_read_bits(src_row, src_x, head) : 0;
+    uint32_t tail_v = (tail != 0) ? gfx_read_bits(src_row, src_x + width - tail, tail) : 0;
+
+    memmove(dst_row + ((dst_x + head) >> 2), src_row + ((src_x + head) >> 2),
+            (width - head - tail) >> 2);
+    if (head != 0) {
+      gfx_blit_bits(dst_row, dst_x, head_v, GFX_SPAN_MASK(head), GFX_OP_SET);
+    }
+    if (tail != 0) {
+      gfx_blit_bits(dst_row, dst_x + width - tail, tail_v, GFX_SPAN_MASK(tail), GFX_OP_SET);
     }
+    return;
+  }
+
+  // Work away from the overlap so that source pixels are read before they are overwritten.
+  if (dst_x < src_x) {
+    for (uint32_t i = 0; i < width; i += GFX_MOVE_CHUNK) {
+      uint32_t n = (width - i < GFX_MOVE_CHUNK) ? width - i : GFX_MOVE_CHUNK;
+      gfx_blit_bits(dst_row, dst_x + i, gfx_read_bits(src_row, src_x + i, n), GFX_SPAN_MASK(n),
+                    GFX_OP_SET);
+    }
+  } else {
+    for (uint32_t end = width; end > 0;) {
+      uint32_t n = (end < GFX_MOVE_CHUNK) ? end : GFX_MOVE_CHUNK;
+      end -= n;
+      gfx_blit_bits(dst_row, dst_x + end, gfx_read_bits(src_row, src_x + end, n), GFX_SPAN_MASK(n),
+                    GFX_OP_SET);
+    }
+  }
+}
+
+void GFX_IN_RAM(gfx_move_rect)(uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y,
+                               uint32_t width, uint32_t height) {
+  if (width == 0) {
+    return;
+  }
+  if (dst_y <= src_y) {
+    for (uint32_t i = 0; i < height; i++) {
+      gfx_move_pixels(gfx_frame_buffer_row(dst_y + i), dst_x, gfx_frame_buffer_row(src_y + i),
+                      src_x, width);
+    }
+  } else {
+    for (uint32_t i = height; i > 0; i--) {
+      gfx_move_pixels(gfx_frame_buffer_row(dst_y + i - 1), dst_x,
+                      gfx_frame_buffer_row(src_y + i - 1), src_x, width);
+    }
+  }
+}
+
+void GFX_IN_RAM(gfx_font_draw_char)(gfx_font_t *font, uint32_t x, uint32_t y, uint8_t c,
+                                    uint8_t active_v, uint8_t inactive_v, gfx_operation_t op) {
+  uint8_t cell_height = font->cell_height;
+  const uint32_t *glyph = gfx_font_get_glyph_cache(font);
+  if (glyph == NULL) {
+    return;
+  }
+  glyph += c * cell_height;
+
+  uint32_t cell_mask = GFX_SPAN_MASK(font->cell_width);
+  uint32_t active_pattern = GFX_PIXEL_PATTERN(active_v);
+  uint32_t inactive_pattern = GFX_PIXEL_PATTERN(inactive_v);
+
+  uint8_t *fb_row = gfx_frame_buffer_row(y);
+  for (int cy = 0; cy < cell_height; cy++, glyph++, fb_row = gfx_next_frame_buffer_row(fb_row)) {
+    uint32_t v = (*glyph & active_pattern) | (~*glyph & inactive_pattern);
+    gfx_blit_bits(fb_row, x, v, cell_mask, op);
+  }
+}
+
+void GFX_IN_RAM(gfx_font_draw_row)(gfx_font_t *font, uint32_t x, uint32_t y,
+                                   const gfx_cell_t *cells, uint32_t n_cells, gfx_operation_t op) {
+  uint8_t cell_height = font->cell_height;
+  uint32_t cell_bits = font->cell_width << 1;
+  const uint32_t *glyphs = gfx_font_get_glyph_cache(font);
+  if ((glyphs == NULL) || (n_cells == 0)) {
+    return;
+  }
+
+  uint32_t cell_mask = GFX_SPAN_MASK(font->cell_width);
+  uint8_t *fb_row = gfx_frame_buffer_row(y);
+  for (int cy = 0; cy < cell_height; cy++, fb_row = gfx_next_frame_buffer_row(fb_row)) {
+    uint8_t *p = fb_row + (x >> 2);
+
+    // Pixels are accumulated MSB-first in acc. The first (x & 0x3) pixels of the first byte are not
+    // part of the run and so are left out of acc_mask.
+    uint32_t acc = 0, acc_mask = 0;
+    uint32_t acc_bits = (x & 0x3) << 1;
+
+    for (const gfx_cell_t *cell = cells; cell != cells + n_cells; cell++) {
+      uint32_t glyph = glyphs[(cell->c * cell_height) + cy];
+      uint32_t v = (glyph & GFX_PIXEL_PATTERN(cell->active_v)) |
+                   (~glyph & GFX_PIXEL_PATTERN(cell->inactive_v));
+      acc |= (v & cell_mask) >> acc_bits;
+      acc_mask |= cell_mask >> acc_bits;
+      acc_bits += cell_bits;
+
+      // Emit whole bytes as soon as they are complete.
+      for (; acc_bits >= 8; acc <<= 8, acc_mask <<= 8, acc_bits -= 8, p++) {
+        gfx_store_byte(p, acc >> 24, acc_mask >> 24, op);
+      }
+    }
+
+    if (acc_bits != 0) {
+      gfx_store_byte(p, acc >> 24, acc_mask >> 24, op);
+    }
+  }
+}
+
+void gfx_set_text_buffer(gfx_font_t *font, gfx_text_cell_t *cells, uint32_t n_cols,
+                         uint32_t n_rows) {
+  // Make sure the glyph cache exists before the line renderer can see the font.
+  if ((cells != NULL) && (gfx_font_get_glyph_cache(font) == NULL)) {
+    cells = NULL;
+  }
+
+  gfx_text_cells = NULL;
+  gfx_text_font = font;
+  gfx_text_n_cols = n_cols;
+  gfx_text_n_rows = n_rows;
+  gfx_text_cells = cells;
+}
+
+void GFX_IN_RAM(gfx_text_set_cells)(uint32_t col, uint32_t row, const gfx_cell_t *cells,
+                                    uint32_t n_cells) {
+  gfx_text_cell_t *p = gfx_text_cells + (row * gfx_text_n_cols) + col;
+  for (const gfx_cell_t *cell = cells; cell != cells + n_cells; cell++, p++) {
+    *p = GFX_TEXT_CELL(cell->c, cell->active_v, cell->inactive_v);
+  }
+}
+
+void gfx_text_move_cells(uint32_t dst_col, uint32_t dst_row, uint32_t src_col, uint32_t src_row,
+                         uint32_t n_cols, uint32_t n_rows) {
+  gfx_text_cell_t *dst = gfx_text_cells + (dst_row * gfx_text_n_cols) + dst_col;
+  gfx_text_cell_t *src = gfx_text_cells + (src_row * gfx_text_n_cols) + src_col;
+  if (dst_row <= src_row) {
+    for (uint32_t i = 0; i < n_rows; i++) {
+      memmove(dst + (i * gfx_text_n_cols), src + (i * gfx_text_n_cols), sizeof(*dst) * n_cols);
+    }
+  } else {
+    for (uint32_t i = n_rows; i > 0; i--) {
+      memmove(dst + ((i - 1) * gfx_text_n_cols), src + ((i - 1) * gfx_text_n_cols),
+              sizeof(*dst) * n_cols);
+    }
+  }
+}
+
+void GFX_IN_RAM(gfx_text_render_line)(uint32_t line, uint8_t *out, uint32_t out_len) {
+  const gfx_text_cell_t *cells = gfx_text_cells;
+  gfx_font_t *font = gfx_text_font;
+  uint8_t *p = out, *end = out + out_len;
+
+  if (cells != NULL) {
+    uint8_t cell_height = font->cell_height;
+    uint32_t row = line / cell_height, cy = line - (row * cell_height);
+
+    if (row < gfx_text_n_rows) {
+      uint32_t cell_bits = font->cell_width << 1;
+      uint32_t cell_mask = GFX_SPAN_MASK(font->cell_width);
+      const uint32_t *glyphs = font->glyph_cache + cy;
+      const gfx_text_cell_t *row_cells = cells + (row * gfx_text_n_cols);
+      uint32_t acc = 0, acc_bits = 0;
+
+      for (const gfx_text_cell_t *cell = row_cells; cell != row_cells + gfx_text_n_cols; cell++) {
+        uint32_t glyph = glyphs[GFX_TEXT_CELL_GLYPH(*cell) * cell_height];
+        uint32_t v = (glyph & GFX_PIXEL_PATTERN(GFX_TEXT_CELL_ACTIVE_V(*cell))) |
+                     (~glyph & GFX_PIXEL_PATTERN(GFX_TEXT_CELL_INACTIVE_V(*cell)));
+        acc |= (v & cell_mask) >> acc_bits;
+        acc_bits += cell_bits;
+
+        for (; (acc_bits >= 8) && (p != end); acc <<= 8, acc_bits -= 8) {
+          *p++ = acc >> 24;
+        }
+      }
+
+      if ((acc_bits != 0) && (p != end)) {
+        *p++ = acc >> 24;
+      }
+    }
+  }
+
+  memset(p, 0, end - p);
+}
+
+void gfx_text_render_line_reference(uint32_t line, uint8_t *out, uint32_t out_len) {
+  gfx_font_t *font = gfx_text_font;
+
+  memset(out, 0, out_len);
+  if (gfx_text_cells == NULL) {
+    return;
+  }
+
+  uint8_t cell_height = font->cell_height, cell_width = font->cell_width;
+  uint32_t matrix_stride = cell_width << 1; // bytes
+  uint32_t row = line / cell_height, cy = line % cell_height;
+  if (row >= gfx_text_n_rows) {
+    return;
+  }
+
+  for (uint32_t x = 0; x < (out_len << 2); x++) {
+    uint32_t col = x / cell_width, cx = x % cell_width;
+    if (col >= gfx_text_n_cols) {
+      break;
+    }
+
+    gfx_text_cell_t cell = gfx_text_cells[(row * gfx_text_n_cols) + col];
+    uint8_t c = GFX_TEXT_CELL_GLYPH(cell);
+    uint32_t bit = ((c & 0xf) * cell_width) + cx;
+    const uint8_t *matrix_row = font->data + (((cell_height * (c >> 4)) + cy) * matrix_stride);
+    uint8_t v = ((matrix_row[bit >> 3] >> (7 - (bit & 0x7))) & 0x1) ? GFX_TEXT_CELL_ACTIVE_V(cell)
+                                                                    : GFX_TEXT_CELL_INACTIVE_V(cell);
+    out[x >> 2] |= v << (6 - ((x & 0x3) << 1));
   }
 }
@@ -1,3 +1,4 @@
+#include <stdbool.h>
 #include <stdint.h>
 
 typedef struct gfx_font gfx_font_t;
@@ -17,10 +18,91 @@ void gfx_set_frame_buffer(uint8_t *frame_buffer, uint32_t stride);
 uint8_t *gfx_get_frame_buffer(void);
 uint32_t gfx_get_frame_buffer_stride(void);
 
+// Set the frame buffer row holding line 0 and the number of rows in the frame buffer. Line y is
+// then stored in row (origin + y) modulo height which matches how videoout_set_scroll() scans out
+// the frame buffer. A height of zero disables wrapping. Reset by gfx_set_frame_buffer().
+void gfx_set_frame_buffer_origin(uint32_t origin, uint32_t height);
+uint32_t gfx_get_frame_buffer_origin(void);
+
+// Fill n_lines whole lines starting at line y with the pixel value v.
+void gfx_fill_lines(uint32_t y, uint32_t n_lines, uint8_t v);
+
+// Move the width by height pixel rectangle at (src_x, src_y) to (dst_x, dst_y). The rectangles
+// may overlap. Rows are moved with memmove() when both rectangles start at the same pixel within a
+// byte, otherwise pixels are shifted into place a few at a time.
+void gfx_move_rect(uint32_t dst_x, uint32_t dst_y, uint32_t src_x, uint32_t src_y, uint32_t width,
+                   uint32_t height);
+
 void gfx_update_pixel(uint32_t x, uint32_t y, uint8_t v, gfx_operation_t op);
 
+// Replicate a 2-bit pixel value across all 16 pixels of a word.
+#define GFX_PIXEL_PATTERN(v) (0x55555555u * ((v) & 0x3))
+
+// Word mask covering the left-most n pixels of a word. Valid for 1 <= n <= 16.
+#define GFX_SPAN_MASK(n) (0xffffffffu << (32 - ((n) << 1)))
+
+// Blit up to 16 pixels held MSB-first in v into the frame buffer row fb_row starting at pixel x.
+// Only pixels covered by mask are written. Whole bytes are stored directly and the span is only
+// shifted if x does not start on a 4 pixel boundary. The shifted span must fit in 32 bits and so
+// (x & 0x3) + width must be at most 16 pixels.
+void gfx_blit_bits(uint8_t *fb_row, uint32_t x, uint32_t v, uint32_t mask, gfx_operation_t op);
+
 uint8_t gfx_font_get_cell_width(gfx_font_t *font);
 uint8_t gfx_font_get_cell_height(gfx_font_t *font);
 
+// Return the font glyphs pre-expanded to the 2bpp frame buffer format. There is one word per glyph
+// scanline, cell height words per glyph, with set pixels as 0b11 and unset pixels as 0b00. The
+// cache is built by the first call, made when the font is set, and is shared by every
+// foreground/background combination drawn with the font. Returns NULL if the cache could not be
+// allocated.
+const uint32_t *gfx_font_get_glyph_cache(gfx_font_t *font);
+
+// Free the glyph cache for a font. It will be rebuilt on next use.
+void gfx_font_release_glyph_cache(gfx_font_t *font);
+
 void gfx_font_draw_char(gfx_font_t *font, uint32_t x, uint32_t y, uint8_t c, uint8_t active_v,
                         uint8_t inactive_v, gfx_operation_t op);
+
+// A single character cell as drawn by gfx_font_draw_row().
+typedef struct {
+  uint8_t c;
+  uint8_t active_v, inactive_v;
+} gfx_cell_t;
+
+// Draw a run of n_cells adjacent character cells starting at (x, y). Each scanline of the whole
+// run is emitted in one left-to-right pass writing contiguous bytes into the frame buffer row. Only
+// the partial bytes at either end of the run are read back. Fonts must be at most 12 pixels wide.
+void gfx_font_draw_row(gfx_font_t *font, uint32_t x, uint32_t y, const gfx_cell_t *cells,
+                       uint32_t n_cells, gfx_operation_t op);
+
+// Character cell for text mode. The glyph is in the low byte and the attributes in the high byte.
+typedef uint16_t gfx_text_cell_t;
+
+#define GFX_TEXT_CELL(c, active_v, inactive_v)                                                     \
+  ((gfx_text_cell_t)(((c) & 0xff) | (((active_v) & 0x3) << 8) | (((inactive_v) & 0x3) << 10)))
+#define GFX_TEXT_CELL_GLYPH(cell) ((cell) & 0xff)
+#define GFX_TEXT_CELL_ACTIVE_V(cell) (((cell) >> 8) & 0x3)
+#define GFX_TEXT_CELL_INACTIVE_V(cell) (((cell) >> 10) & 0x3)
+
+// Set the cell array and font used to generate lines in text mode. Cells are stored row-major with
+// n_cols cells per row. Pass a NULL cells pointer to disable text mode; lines are then blank.
+void gfx_set_text_buffer(gfx_font_t *font, gfx_text_cell_t *cells, uint32_t n_cols,
+                         uint32_t n_rows);
+
+// Store a run of n_cells cells into the text mode cell array starting at (col, row).
+void gfx_text_set_cells(uint32_t col, uint32_t row, const gfx_cell_t *cells, uint32_t n_cells);
+
+// Move the n_cols by n_rows block of text mode cells at (src_col, src_row) to (dst_col, dst_row).
+// The blocks may overlap.
+void gfx_text_move_cells(uint32_t dst_col, uint32_t dst_row, uint32_t src_col, uint32_t src_row,
+                         uint32_t n_cols, uint32_t n_rows);
+
+// Generate one line of output from the text mode cell array into out which is out_len bytes long.
+// Output is in the frame buffer format and pixels outside of the cell array are black. Suitable for
+// use from interrupt context.
+void gfx_text_render_line(uint32_t line, uint8_t *out, uint32_t out_len);
+
+// Reference implementation of gfx_text_render_line() which works a pixel at a time directly from
+// the font bitmap. The output of both is bit-exact and this version can be used on a host to check
+// gfx_text_render_line().
+void gfx_text_render_line_reference(uint32_t line, uint8_t *out, uint32_t out_len);
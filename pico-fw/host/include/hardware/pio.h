@@ -0,0 +1,10 @@
+#pragma once
+
+#include "pico.h"
+
+// There is no PIO on the host. videoout_init() is passed a null instance.
+typedef struct pio_hw pio_hw_t;
+typedef pio_hw_t *PIO;
+
+#define pio0 ((PIO)NULL)
+#define pio1 ((PIO)NULL)
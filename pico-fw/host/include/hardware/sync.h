@@ -0,0 +1,15 @@
+#pragma once
+
+#include "pico.h"
+
+// Interrupts are threads which hold the host interrupt lock while they run, so disabling
+// interrupts takes the lock. See host/platform.c.
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+// Each thread has its own event flag, as each core does. __sev() sets every thread's and __wfe()
+// waits for the calling thread's and clears it.
+void __sev(void);
+void __wfe(void);
+
+static inline void __dmb(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
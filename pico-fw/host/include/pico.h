@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/types.h"
+
+// Host stand-ins for the parts of the Pico SDK used by the firmware core. See host/platform.c.
+
+// Code placement has no meaning on the host.
+#define __not_in_flash_func(func) func
+#define __time_critical_func(func) func
+
+static inline void tight_loop_contents(void) {}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "pico.h"
+
+// Run entry on a second thread.
+void multicore_launch_core1(void (*entry)(void));
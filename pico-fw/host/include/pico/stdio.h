@@ -0,0 +1,6 @@
+#pragma once
+
+#include "pico.h"
+
+// Input is read from stdin by host/platform.c and output is written to stdout.
+bool stdio_init_all(void);
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "pico.h"
+
+// Microseconds since the host build started.
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
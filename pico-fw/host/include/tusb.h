@@ -0,0 +1,8 @@
+#pragma once
+
+#include "pico.h"
+
+// USB CDC receive, fed from stdin by host/platform.c. tud_cdc_rx_cb() is provided by input.c.
+uint32_t tud_cdc_available(void);
+uint32_t tud_cdc_read(void *buffer, uint32_t bufsize);
+void tud_cdc_rx_cb(uint8_t itf);
@@ -0,0 +1,185 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "pico/stdio.h"
+#include "pico/stdlib.h"
+#include "tusb.h"
+
+#include "input.h"
+#include "videoout.h"
+#include "videoout_host.h"
+
+// The parts of the Pico SDK used by the firmware core, in terms of POSIX threads. Each core is a
+// thread, as is each source of interrupts: the stdin reader in place of USB and the field thread
+// in videoout_host.c.
+
+// Size of the receive FIFO standing in for TinyUSB's. Small, as TinyUSB's is, so that the input
+// buffer's flow control is exercised.
+#define RX_FIFO_SIZE 256
+
+// In firmware.c.
+bool firmware_is_idle(void);
+
+uint64_t time_us_64(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+}
+
+uint32_t time_us_32(void) { return (uint32_t)time_us_64(); }
+
+// Interrupt handlers hold this while they run. It is recursive since the firmware may disable
+// interrupts from within a handler.
+static pthread_mutex_t irq_lock;
+static pthread_once_t irq_lock_once = PTHREAD_ONCE_INIT;
+
+static void irq_lock_init(void) {
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&irq_lock, &attr);
+  pthread_mutexattr_destroy(&attr);
+}
+
+uint32_t save_and_disable_interrupts(void) {
+  pthread_once(&irq_lock_once, irq_lock_init);
+  pthread_mutex_lock(&irq_lock);
+  return 0;
+}
+
+void restore_interrupts(uint32_t status) { pthread_mutex_unlock(&irq_lock); }
+
+// Events sent by __sev(). A thread's event flag is set while the count differs from the count it
+// last saw.
+static pthread_mutex_t event_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t event_cond = PTHREAD_COND_INITIALIZER;
+static uint64_t event_count = 0;
+static _Thread_local uint64_t event_count_seen = 0;
+
+void __sev(void) {
+  pthread_mutex_lock(&event_lock);
+  event_count++;
+  pthread_cond_broadcast(&event_cond);
+  pthread_mutex_unlock(&event_lock);
+}
+
+void __wfe(void) {
+  pthread_mutex_lock(&event_lock);
+  while (event_count == event_count_seen) {
+    pthread_cond_wait(&event_cond, &event_lock);
+  }
+  event_count_seen = event_count;
+  pthread_mutex_unlock(&event_lock);
+}
+
+static void *core1_thread(void *entry) {
+  ((void (*)(void))entry)();
+  return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, core1_thread, (void *)entry) != 0) {
+    perror("core 1");
+    exit(1);
+  }
+  pthread_detach(thread);
+}
+
+// Bytes received from stdin and not yet read by input.c. Only accessed with interrupts disabled.
+static char rx_fifo[RX_FIFO_SIZE];
+static uint32_t rx_fifo_len = 0;
+
+uint32_t tud_cdc_available(void) { return rx_fifo_len; }
+
+uint32_t tud_cdc_read(void *buffer, uint32_t bufsize) {
+  uint32_t n = (bufsize < rx_fifo_len) ? bufsize : rx_fifo_len;
+  memcpy(buffer, rx_fifo, n);
+  memmove(rx_fifo, rx_fifo + n, rx_fifo_len - n);
+  rx_fifo_len -= n;
+  return n;
+}
+
+// Once stdin is exhausted and everything read from it has been parsed and shown, write any
+// screenshot asked for by FIRMWARE_HOST_SCREENSHOT and exit.
+static void exit_when_shown(void) {
+  while (true) {
+    uint32_t save = save_and_disable_interrupts();
+    bool idle = (rx_fifo_len == 0) && firmware_is_idle() && !videoout_host_present_pending();
+    restore_interrupts(save);
+    if (idle) {
+      break;
+    }
+    usleep(1000);
+  }
+
+  // Nothing changes once idle, but a cursor set last is only taken at the start of a field. Fields
+  // hold the interrupt lock throughout, so the first vblank signalled after any already pending
+  // ends a field started since.
+  videoout_wait_for_vblank();
+  videoout_wait_for_vblank();
+
+  int status = 0;
+  const char *path = getenv("FIRMWARE_HOST_SCREENSHOT");
+  if ((path != NULL) && !videoout_host_write_pgm(path)) {
+    perror(path);
+    status = 1;
+  }
+  fflush(stdout);
+  _exit(status);
+}
+
+// Feed stdin to input.c as TinyUSB would, holding off when the FIFO is full.
+static void *stdin_thread(void *arg) {
+  char bytes[RX_FIFO_SIZE];
+  while (true) {
+    ssize_t len = read(STDIN_FILENO, bytes, sizeof(bytes));
+    if ((len < 0) && (errno == EINTR)) {
+      continue;
+    }
+    if (len <= 0) {
+      break;
+    }
+
+    ssize_t offset = 0;
+    while (offset < len) {
+      uint32_t save = save_and_disable_interrupts();
+      uint32_t n = RX_FIFO_SIZE - rx_fifo_len;
+      if (n > len - offset) {
+        n = len - offset;
+      }
+      memcpy(rx_fifo + rx_fifo_len, bytes + offset, n);
+      rx_fifo_len += n;
+      offset += n;
+      if (n > 0) {
+        tud_cdc_rx_cb(0);
+      }
+      restore_interrupts(save);
+      if (offset < len) {
+        usleep(1000);
+      }
+    }
+  }
+  exit_when_shown();
+  return NULL;
+}
+
+bool stdio_init_all(void) {
+  // Send replies as they are written, as USB stdio does.
+  setvbuf(stdout, NULL, _IONBF, 0);
+
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, stdin_thread, NULL) != 0) {
+    return false;
+  }
+  pthread_detach(thread);
+  return true;
+}
@@ -0,0 +1,306 @@
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "arena.h"
+#include "term.h"
+
+// Check that what firmware_host shows after random, scroll-heavy input, drawn through the render
+// queue, the snapshot and the moves made to the frame buffer, matches what it shows for the same
+// screen written out cell by cell with no scrolling or moves. The screen is found by feeding the
+// input to the terminal backend firmware_host is built with, linked in here. The cursor is hidden
+// in both so that its blinking does not matter.
+//
+// Usage: test_render_pipeline path/to/firmware_host [n_seeds]
+//
+// On failure both inputs and both screenshots are left in the current directory.
+
+// The size of the terminal in the 864x350 mode with the 8x14 font, as firmware.c sets it up.
+#define N_ROWS 25
+#define N_COLS 108
+
+#define DEFAULT_SEEDS 20
+#define N_OPS 1500
+
+#define INPUT_PATH "render_pipeline.in"
+#define SCREENSHOT_PATH "render_pipeline.pgm"
+#define REFERENCE_INPUT_PATH "render_pipeline_reference.in"
+#define REFERENCE_PATH "render_pipeline_reference.pgm"
+
+typedef struct {
+  char *bytes;
+  size_t len, size;
+} buffer_t;
+
+static void append(buffer_t *buf, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  char text[256];
+  int len = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+
+  if (buf->len + len > buf->size) {
+    buf->size = (buf->len + len) * 2;
+    buf->bytes = realloc(buf->bytes, buf->size);
+    if (buf->bytes == NULL) {
+      perror("realloc");
+      exit(1);
+    }
+  }
+  memcpy(buf->bytes + buf->len, text, len);
+  buf->len += len;
+}
+
+static int random_in(unsigned *seed, int min, int max) {
+  return min + (rand_r(seed) % (max - min + 1));
+}
+
+// Text and attributes mixed with the sequences which move and scroll parts of the screen.
+static void make_input(unsigned seed, buffer_t *input) {
+  input->len = 0;
+  for (int op = 0; op < N_OPS; op++) {
+    switch (random_in(&seed, 0, 15)) {
+    case 0:
+    case 1:
+    case 2: {
+      int len = random_in(&seed, 1, 2 * N_COLS);
+      for (int i = 0; i < len; i++) {
+        append(input, "%c", random_in(&seed, '!', '~'));
+      }
+      break;
+    }
+    case 3:
+      append(input, "\r\n");
+      break;
+    case 4:
+      // Colours the firmware shows black, dim and bright, so that the text stays visible, and the
+      // defaults.
+      switch (random_in(&seed, 0, 4)) {
+      case 0:
+      case 1:
+        append(input, "\033[0m");
+        break;
+      case 2:
+        append(input, "\033[%dm", random_in(&seed, 0, 1) ? 7 : 27);
+        break;
+      case 3:
+        append(input, "\033[3%cm", "0179"[random_in(&seed, 0, 3)]);
+        break;
+      default:
+        append(input, "\033[4%cm", "19"[random_in(&seed, 0, 1)]);
+        break;
+      }
+      break;
+    case 5:
+      append(input, "\033[%d;%dH", random_in(&seed, 1, N_ROWS), random_in(&seed, 1, N_COLS));
+      break;
+    case 6: {
+      int top = random_in(&seed, 1, N_ROWS - 1);
+      append(input, "\033[%d;%dr", top, random_in(&seed, top + 1, N_ROWS));
+      break;
+    }
+    case 7:
+      append(input, "\033[r");
+      break;
+    case 8:
+      append(input, random_in(&seed, 0, 1) ? "\033D" : "\033M");
+      break;
+    case 9:
+      append(input, "\033[%d%c", random_in(&seed, 1, 5), random_in(&seed, 0, 1) ? 'L' : 'M');
+      break;
+    case 10:
+      append(input, "\033[%d%c", random_in(&seed, 1, 10), "@PX"[random_in(&seed, 0, 2)]);
+      break;
+    case 11:
+      append(input, "\033[%d%c", random_in(&seed, 1, 5), random_in(&seed, 0, 1) ? 'S' : 'T');
+      break;
+    case 12:
+      // Erasing the display is rare so that the screen is kept mostly full.
+      append(input, "\033[%d%c", random_in(&seed, 0, 2), random_in(&seed, 0, 15) ? 'K' : 'J');
+      break;
+    case 13: {
+      // Left and right margins, so that moves are narrower than the screen.
+      int left = random_in(&seed, 1, N_COLS - 1);
+      append(input, "\033[?69h\033[%d;%ds", left, random_in(&seed, left + 1, N_COLS));
+      break;
+    }
+    case 14:
+      append(input, "\033[?69l");
+      break;
+    default:
+      append(input, "\033[4%c", random_in(&seed, 0, 1) ? 'h' : 'l');
+      break;
+    }
+  }
+  append(input, "\033[?25l");
+}
+
+// The default colours firmware.c sets, which the backends report in place of the defaults.
+static const term_color_t default_fg = {
+    .type = TERM_COLOR_RGB, .red = 255, .green = 255, .blue = 255};
+static const term_color_t default_bg = {.type = TERM_COLOR_RGB};
+
+// Set the colour with the SGR codes every backend takes where it can.
+static void append_color(buffer_t *buf, const term_color_t *color, int base) {
+  const term_color_t *default_color = (base == 30) ? &default_fg : &default_bg;
+  if (memcmp(color, default_color, sizeof(*color)) == 0) {
+    append(buf, ";%d", base + 9);
+  } else if ((color->type == TERM_COLOR_INDEXED) && (color->idx < 8)) {
+    append(buf, ";%d", base + color->idx);
+  } else if ((color->type == TERM_COLOR_INDEXED) && (color->idx < 16)) {
+    append(buf, ";%d", base + 60 + color->idx - 8);
+  } else if (color->type == TERM_COLOR_INDEXED) {
+    append(buf, ";%d;5;%d", base + 8, color->idx);
+  } else {
+    append(buf, ";%d;2;%d;%d;%d", base + 8, color->red, color->green, color->blue);
+  }
+}
+
+static void append_cell(buffer_t *buf, const term_cell_t *cell) {
+  append(buf, "\033[0%s", cell->reverse ? ";7" : "");
+  append_color(buf, &cell->fg, 30);
+  append_color(buf, &cell->bg, 40);
+  append(buf, "m%c", (cell->ch != 0) ? (char)cell->ch : ' ');
+}
+
+// Only the screen is wanted, so the optional callbacks are left out and the backend shows reverse
+// video in the cells itself.
+static void ignore_damage(term_rect_t rect) {}
+static void ignore_move_cursor(term_pos_t pos, term_pos_t old_pos, bool visible) {}
+static void ignore_cursor_visible(bool visible) {}
+static void ignore_output(const char *bytes, size_t len) {}
+
+static const term_callbacks_t callbacks = {
+    .damage = ignore_damage,
+    .move_cursor = ignore_move_cursor,
+    .set_cursor_visible = ignore_cursor_visible,
+    .output = ignore_output,
+};
+
+static bool write_file(const char *path, const buffer_t *buf) {
+  FILE *f = fopen(path, "wb");
+  if (f == NULL) {
+    perror(path);
+    return false;
+  }
+  fwrite(buf->bytes, 1, buf->len, f);
+  return fclose(f) == 0;
+}
+
+// Run firmware_host with input on stdin and have it write what it shows to path.
+static bool run_firmware(const char *firmware, const buffer_t *input, const char *path) {
+  char command[1024];
+  snprintf(command, sizeof(command), "'%s' >/dev/null", firmware);
+  setenv("FIRMWARE_HOST_SCREENSHOT", path, 1);
+  FILE *f = popen(command, "w");
+  if (f == NULL) {
+    perror(firmware);
+    return false;
+  }
+  fwrite(input->bytes, 1, input->len, f);
+  if (pclose(f) != 0) {
+    printf("%s failed\n", firmware);
+    return false;
+  }
+  return true;
+}
+
+static bool read_file(const char *path, buffer_t *buf) {
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    perror(path);
+    return false;
+  }
+  buf->len = 0;
+  int c;
+  while ((c = fgetc(f)) != EOF) {
+    append(buf, "%c", c);
+  }
+  fclose(f);
+  return true;
+}
+
+// Write out the screen the backend shows after the input a cell at a time from the top, without
+// scrolling, with the attributes the firmware draws, to REFERENCE_INPUT_PATH. The backends keep
+// their one terminal in static state, so this is done in a child process with a fresh terminal.
+static bool make_reference_input(const buffer_t *input) {
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    return false;
+  }
+  if (pid == 0) {
+    static uint8_t arena_memory[4 * 1024 * 1024];
+    arena_init(arena_memory, sizeof(arena_memory));
+    term_init(N_ROWS, N_COLS, &callbacks);
+    term_set_default_colors(&default_fg, &default_bg);
+    term_input_write(input->bytes, input->len);
+
+    buffer_t reference = {0};
+    append(&reference, "\033[?25l");
+    for (int row = 0; row < N_ROWS; row++) {
+      term_cell_t cells[N_COLS];
+      term_get_row(row, 0, N_COLS, cells);
+#if defined(TERM_BACKEND_TMT)
+      // libtmt scrolls as soon as the bottom right cell is written, so write the bottom row one up
+      // and insert a line above it for the row before.
+      if (row == N_ROWS - 2) {
+        term_cell_t bottom_cells[N_COLS];
+        term_get_row(N_ROWS - 1, 0, N_COLS, bottom_cells);
+        append(&reference, "\033[%d;1H", row + 1);
+        for (int col = 0; col < N_COLS; col++) {
+          append_cell(&reference, &bottom_cells[col]);
+        }
+        append(&reference, "\033[%d;1H\033[L", row + 1);
+      } else if (row == N_ROWS - 1) {
+        break;
+      }
+#endif
+      append(&reference, "\033[%d;1H", row + 1);
+      for (int col = 0; col < N_COLS; col++) {
+        append_cell(&reference, &cells[col]);
+      }
+    }
+    _exit(write_file(REFERENCE_INPUT_PATH, &reference) ? 0 : 1);
+  }
+  int status;
+  if ((waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+    printf("finding the reference screen failed\n");
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s firmware_host [n_seeds]\n", argv[0]);
+    return 2;
+  }
+  unsigned n_seeds = (argc > 2) ? (unsigned)atoi(argv[2]) : DEFAULT_SEEDS;
+
+  buffer_t input = {0}, reference = {0}, shown = {0}, expected = {0};
+  for (unsigned seed = 1; seed <= n_seeds; seed++) {
+    make_input(seed, &input);
+    if (!write_file(INPUT_PATH, &input) || !make_reference_input(&input) ||
+        !read_file(REFERENCE_INPUT_PATH, &reference) ||
+        !run_firmware(argv[1], &input, SCREENSHOT_PATH) ||
+        !run_firmware(argv[1], &reference, REFERENCE_PATH) || !read_file(SCREENSHOT_PATH, &shown) ||
+        !read_file(REFERENCE_PATH, &expected)) {
+      return 1;
+    }
+    if ((shown.len != expected.len) || (memcmp(shown.bytes, expected.bytes, shown.len) != 0)) {
+      printf("seed %u: %s differs from %s for the input in %s\n", seed, SCREENSHOT_PATH,
+             REFERENCE_PATH, INPUT_PATH);
+      return 1;
+    }
+  }
+  remove(INPUT_PATH);
+  remove(REFERENCE_INPUT_PATH);
+  remove(SCREENSHOT_PATH);
+  remove(REFERENCE_PATH);
+  return 0;
+}
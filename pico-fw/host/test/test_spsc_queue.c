@@ -0,0 +1,114 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "spsc_queue.h"
+
+// Pass entries through the queue from one thread to another, each side pausing at random so that
+// the queue runs both full and empty, and check that every entry arrives once, intact and in order.
+// Each seed picks the capacity and entry size.
+
+#define N_SEEDS 200
+#define N_ENTRIES 2000
+#define MAX_ENTRY_SIZE 16
+
+static uint8_t arena_memory[4 * 1024];
+
+static spsc_queue_t queue;
+static size_t entry_size;
+
+static void make_entry(uint32_t i, uint8_t *entry) {
+  for (size_t j = 0; j < entry_size; j++) {
+    entry[j] = (uint8_t)((i >> (8 * (j % 4))) + (j * 0x35));
+  }
+}
+
+// Spin for a random few iterations now and then, as the other core would be busy.
+static void pause_at_random(unsigned *seed) {
+  if ((rand_r(seed) % 8) == 0) {
+    for (volatile int n = rand_r(seed) % 1000; n > 0; n--) {
+    }
+  }
+}
+
+static bool is_full(void) {
+  return atomic_load(&queue.tail) - atomic_load(&queue.head) >= queue.capacity;
+}
+
+static void *producer(void *arg) {
+  unsigned seed = *(unsigned *)arg;
+  for (uint32_t i = 0; i < N_ENTRIES; i++) {
+    uint8_t entry[MAX_ENTRY_SIZE];
+    make_entry(i, entry);
+
+    // Mostly yield rather than leaving spsc_queue_push() to spin while the queue is full, which
+    // would take whole time slices on a single processor.
+    if ((rand_r(&seed) % 256) != 0) {
+      while (is_full()) {
+        sched_yield();
+      }
+    }
+    spsc_queue_push(&queue, entry);
+    pause_at_random(&seed);
+  }
+  return NULL;
+}
+
+static bool check(unsigned test_seed) {
+  unsigned seed = test_seed;
+  uint32_t capacity = 1u << (rand_r(&seed) % 7);
+  entry_size = 1 + (rand_r(&seed) % MAX_ENTRY_SIZE);
+
+  arena_init(arena_memory, sizeof(arena_memory));
+  queue.entries = NULL;
+  if (!spsc_queue_init(&queue, entry_size, capacity)) {
+    printf("seed %u: could not allocate %u entries of %zu bytes\n", test_seed, capacity,
+           entry_size);
+    return false;
+  }
+
+  pthread_t thread;
+  unsigned producer_seed = rand_r(&seed);
+  if (pthread_create(&thread, NULL, producer, &producer_seed) != 0) {
+    perror("producer");
+    return false;
+  }
+
+  // Drain every entry even after a failure so that the producer finishes.
+  bool ok = true;
+  for (uint32_t i = 0; i < N_ENTRIES;) {
+    uint8_t entry[MAX_ENTRY_SIZE], expected[MAX_ENTRY_SIZE];
+    if (!spsc_queue_pop(&queue, entry)) {
+      sched_yield();
+      continue;
+    }
+    make_entry(i, expected);
+    if (ok && (memcmp(entry, expected, entry_size) != 0)) {
+      printf("seed %u: entry %u of %zu bytes with capacity %u differs\n", test_seed, i, entry_size,
+             capacity);
+      ok = false;
+    }
+    i++;
+    pause_at_random(&seed);
+  }
+
+  pthread_join(thread, NULL);
+  if (ok && !spsc_queue_is_empty(&queue)) {
+    printf("seed %u: queue not empty after the last entry\n", test_seed);
+    ok = false;
+  }
+  return ok;
+}
+
+int main(void) {
+  int failures = 0;
+  for (unsigned seed = 1; seed <= N_SEEDS; seed++) {
+    if (!check(seed)) {
+      failures++;
+    }
+  }
+  return (failures == 0) ? 0 : 1;
+}
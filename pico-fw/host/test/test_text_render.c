@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "graphics.h"
+
+// Check gfx_text_render_line() against gfx_text_render_line_reference() for every font at the
+// width of each standard mode, with random cells and attributes.
+
+#define SCREEN_HEIGHT 350
+#define MAX_STRIDE (1056 / 4)
+
+static uint8_t arena_memory[64 * 1024];
+
+static gfx_text_cell_t cells[(1056 / 8) * (SCREEN_HEIGHT / 8)];
+
+static bool check(const char *font_name, gfx_font_t *font, uint32_t width) {
+  uint32_t n_cols = width / gfx_font_get_cell_width(font);
+  uint32_t n_rows = SCREEN_HEIGHT / gfx_font_get_cell_height(font);
+  for (uint32_t i = 0; i < n_cols * n_rows; i++) {
+    cells[i] = GFX_TEXT_CELL(rand(), rand(), rand());
+  }
+  gfx_set_text_buffer(font, cells, n_cols, n_rows);
+
+  // Lines past the last row and bytes past the last column are blank in both.
+  for (uint32_t line = 0; line < SCREEN_HEIGHT + 2; line++) {
+    uint8_t out[MAX_STRIDE + 4], reference[MAX_STRIDE + 4];
+    memset(out, 0xa5, sizeof(out));
+    gfx_text_render_line(line, out, (width / 4) + 4);
+    gfx_text_render_line_reference(line, reference, (width / 4) + 4);
+    if (memcmp(out, reference, (width / 4) + 4) != 0) {
+      printf("%s at %u dots: line %u differs\n", font_name, width, line);
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(void) {
+  static const struct {
+    const char *name;
+    gfx_font_t *font;
+  } fonts[] = {
+      {"cga_8x8", &gfx_cga_8x8_font},
+      {"mda_8x14", &gfx_mda_8x14_font},
+      {"mda_9x14", &gfx_mda_9x14_font},
+  };
+  static const uint32_t widths[] = {720, 864, 1024, 1056};
+
+  arena_init(arena_memory, sizeof(arena_memory));
+  srand(1);
+
+  int failures = 0;
+  for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+      failures += !check(fonts[f].name, fonts[f].font, widths[w]);
+    }
+  }
+  return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+#include <stdio.h>
+
+#include "videoout.h"
+
+#include "video_modes.h"
+
+// Check each standard mode against videoout_mode_is_valid(), as videoout_set_mode() does, and that
+// it is narrow enough for text mode and the cursor.
+
+static bool check(const char *name, const videoout_mode_t *mode) {
+  if (!videoout_mode_is_valid(mode)) {
+    printf("%s: not valid\n", name);
+    return false;
+  }
+  if (mode->visible_dots_per_line > VIDEOOUT_LINE_BUFFER_MAX_DOTS) {
+    printf("%s: %u dots is wider than VIDEOOUT_LINE_BUFFER_MAX_DOTS\n", name,
+           mode->visible_dots_per_line);
+    return false;
+  }
+  return true;
+}
+
+int main(void) {
+  static const struct {
+    const char *name;
+    const videoout_mode_t *mode;
+  } modes[] = {
+      {"720_350", &videoout_mode_720_350},
+      {"864_350", &videoout_mode_864_350},
+      {"1024_350", &videoout_mode_1024_350},
+      {"1056_350", &videoout_mode_1056_350},
+  };
+
+  int failures = 0;
+  for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+    failures += !check(modes[i].name, modes[i].mode);
+  }
+  return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,409 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+#include "videoout.h"
+#include "videoout_host.h"
+
+// Software stand-in for videoout.c. A thread runs at the mode's frame rate and, as the DMA
+// interrupts would, takes any presented frame buffer, cursor and polarity change at the start of
+// each field, scans out the visible lines, calling any line renderer, into a screen image and then
+// signals vblank. It holds the host interrupt lock throughout, so the firmware sees it as an
+// interrupt. Sync timing is not generated and the pins are ignored.
+
+#include "video_modes.h"
+
+static const videoout_mode_t *active_mode = NULL;
+static videoout_vblank_callback_t vblank_callback = NULL;
+static videoout_line_renderer_t line_renderer = NULL;
+
+static pthread_t field_thread;
+static volatile bool videoout_is_running = false;
+
+// Frame buffer and scroll shown from the start of the next field.
+static _Atomic uintptr_t frame_buffer_ptr = 0;
+static atomic_uint scroll_line = 0;
+
+// Guards the present and vblank state below, which are waited on via video_cond.
+static pthread_mutex_t video_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t video_cond = PTHREAD_COND_INITIALIZER;
+
+// Frame buffer and scroll queued by videoout_present().
+static bool present_pending = false;
+static void *present_frame_buffer;
+static uint present_scroll;
+
+// Set at each vblank and cleared by videoout_wait_for_vblank(), as the binary semaphore is.
+static bool vblank_signalled = false;
+
+// Cursor overlay, as in videoout.c.
+typedef struct {
+  uint first_line, n_lines;
+  uint first_byte, n_bytes;
+  uint8_t first_mask, last_mask;
+} cursor_t;
+
+static cursor_t cursor, next_cursor;
+static bool next_cursor_pending = false;
+
+static volatile bool reverse_video = false;
+static volatile uint flash_fields = 0;
+static bool output_inverted = false;
+
+static volatile uint cursor_blink_period = 0;
+static uint cursor_blink_count = 0;
+static bool cursor_blink_shown = true;
+
+// The last field shown, one pixel per byte in the frame buffer's two bit format.
+static uint8_t *screen = NULL;
+
+alignas(4) static uint8_t line_buffer[VIDEOOUT_LINE_BUFFER_MAX_DOTS >> 2];
+
+static videoout_stats_t stats;
+
+// Take any cursor set since the last field and advance the blink.
+static void cursor_next_field(void) {
+  pthread_mutex_lock(&video_lock);
+  if (next_cursor_pending) {
+    cursor = next_cursor;
+    next_cursor_pending = false;
+    cursor_blink_count = 0;
+    cursor_blink_shown = true;
+  }
+  pthread_mutex_unlock(&video_lock);
+
+  if (cursor_blink_period == 0) {
+    cursor_blink_shown = true;
+  } else if (++cursor_blink_count >= cursor_blink_period) {
+    cursor_blink_count = 0;
+    cursor_blink_shown = !cursor_blink_shown;
+  }
+}
+
+static void output_polarity_update(void) {
+  bool invert = reverse_video;
+  if (flash_fields > 0) {
+    flash_fields--;
+    invert = !invert;
+  }
+  output_inverted = invert;
+}
+
+static void field_start(void) {
+  cursor_next_field();
+  output_polarity_update();
+
+  pthread_mutex_lock(&video_lock);
+  if (present_pending) {
+    atomic_store(&frame_buffer_ptr, (uintptr_t)present_frame_buffer);
+    atomic_store(&scroll_line, present_scroll);
+    present_pending = false;
+    pthread_cond_broadcast(&video_cond);
+  }
+  pthread_mutex_unlock(&video_lock);
+}
+
+// Copy one visible line into the screen image with the cursor and polarity applied.
+static void scan_out_line(uint line, const uint8_t *pixels) {
+  uint width = active_mode->visible_dots_per_line;
+  uint8_t *out = screen + (line * width);
+  bool on_cursor = cursor_blink_shown && (line - cursor.first_line < cursor.n_lines);
+  for (uint x = 0; x < width; x++) {
+    uint8_t byte = (pixels == NULL) ? 0 : pixels[x >> 2];
+    uint i = (x >> 2) - cursor.first_byte;
+    if (on_cursor && (i < cursor.n_bytes)) {
+      uint8_t mask = (i == 0) ? cursor.first_mask : 0xff;
+      if (i == cursor.n_bytes - 1) {
+        mask &= cursor.last_mask;
+      }
+      byte ^= mask;
+    }
+    uint8_t pixel = (byte >> (6 - ((x & 3) << 1))) & 3;
+    out[x] = output_inverted ? (pixel ^ 3) : pixel;
+  }
+}
+
+static void field_scan_out(void) {
+  uint height = active_mode->visible_lines_per_frame;
+  uint stride = videoout_get_screen_stride();
+  const uint8_t *frame_buffer = (const uint8_t *)atomic_load(&frame_buffer_ptr);
+  uint scroll = atomic_load(&scroll_line);
+  for (uint line = 0; line < height; line++) {
+    const uint8_t *pixels;
+    if (line_renderer != NULL) {
+      line_renderer(line, line_buffer);
+      pixels = line_buffer;
+    } else {
+      pixels = (frame_buffer == NULL) ? NULL : frame_buffer + (((scroll + line) % height) * stride);
+    }
+    scan_out_line(line, pixels);
+  }
+}
+
+static void field_vblank(void) {
+  pthread_mutex_lock(&video_lock);
+  vblank_signalled = true;
+  pthread_cond_broadcast(&video_cond);
+  pthread_mutex_unlock(&video_lock);
+
+  if (vblank_callback != NULL) {
+    vblank_callback();
+  }
+}
+
+// Frame period of the active mode in ns.
+static uint64_t frame_period_ns(void) {
+  uint64_t frame_cycles = (uint64_t)active_mode->dots_per_line * active_mode->sys_clocks_per_dot *
+                          active_mode->lines_per_frame;
+  return (frame_cycles * 1000000) / active_mode->sys_clock_khz;
+}
+
+static uint64_t time_ns(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000) + now.tv_nsec;
+}
+
+static void *field_thread_main(void *arg) {
+  uint64_t period_ns = frame_period_ns(), next_ns = time_ns();
+
+  while (videoout_is_running) {
+    next_ns += period_ns;
+    struct timespec next = {.tv_sec = next_ns / 1000000000, .tv_nsec = next_ns % 1000000000};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR) {
+    }
+
+    uint32_t save = save_and_disable_interrupts();
+    uint32_t start_us = time_us_32();
+    field_start();
+    field_scan_out();
+    stats.frames++;
+    stats.phase_start_us[2] = start_us;
+    stats.vblank_time_us = time_us_32();
+    field_vblank();
+
+    // Drop any frames overrun rather than catching up with them.
+    uint64_t now_ns = time_ns();
+    while (now_ns > next_ns + period_ns) {
+      next_ns += period_ns;
+      stats.missed_frames++;
+    }
+    restore_interrupts(save);
+
+    // Interrupts wake a core waiting for an event.
+    __sev();
+  }
+  return NULL;
+}
+
+void videoout_init(PIO pio, uint sync_pin_base, uint video_pin_base) {}
+
+bool videoout_set_mode(const videoout_mode_t *mode) {
+  if (videoout_is_running) {
+    return false;
+  }
+  if (!videoout_mode_is_valid(mode)) {
+    return false;
+  }
+  if ((line_renderer != NULL) && (mode->visible_dots_per_line > VIDEOOUT_LINE_BUFFER_MAX_DOTS)) {
+    return false;
+  }
+  uint8_t *new_screen =
+      realloc(screen, (size_t)mode->visible_dots_per_line * mode->visible_lines_per_frame);
+  if (new_screen == NULL) {
+    return false;
+  }
+  screen = new_screen;
+  memset(screen, 0, (size_t)mode->visible_dots_per_line * mode->visible_lines_per_frame);
+  active_mode = mode;
+  return true;
+}
+
+// The PLL search is specific to the RP2040, so the host has no modes but the standard ones.
+bool videoout_solve_mode(const videoout_mode_target_t *target, videoout_mode_t *mode,
+                         videoout_mode_error_t *error) {
+  return false;
+}
+
+void videoout_start(void) {
+  if (videoout_is_running || (active_mode == NULL)) {
+    return;
+  }
+  videoout_is_running = true;
+  if (pthread_create(&field_thread, NULL, field_thread_main, NULL) != 0) {
+    videoout_is_running = false;
+  }
+}
+
+void videoout_stop(void) {
+  if (!videoout_is_running) {
+    return;
+  }
+  videoout_is_running = false;
+  pthread_join(field_thread, NULL);
+
+  // Show any pending present immediately rather than leaving it queued.
+  pthread_mutex_lock(&video_lock);
+  if (present_pending) {
+    atomic_store(&frame_buffer_ptr, (uintptr_t)present_frame_buffer);
+    atomic_store(&scroll_line, present_scroll);
+    present_pending = false;
+    pthread_cond_broadcast(&video_cond);
+  }
+  pthread_mutex_unlock(&video_lock);
+}
+
+void videoout_cleanup(void) {
+  videoout_stop();
+  free(screen);
+  screen = NULL;
+  active_mode = NULL;
+}
+
+void videoout_set_vblank_callback(videoout_vblank_callback_t callback) {
+  vblank_callback = callback;
+}
+
+uint videoout_get_screen_width(void) {
+  return (active_mode == NULL) ? 0 : active_mode->visible_dots_per_line;
+}
+
+uint videoout_get_screen_height(void) {
+  return (active_mode == NULL) ? 0 : active_mode->visible_lines_per_frame;
+}
+
+uint videoout_get_screen_stride(void) {
+  return (active_mode == NULL) ? 0 : (active_mode->visible_dots_per_line >> 4) << 2;
+}
+
+void videoout_set_frame_buffer(void *frame_buffer) {
+  atomic_store(&frame_buffer_ptr, (uintptr_t)frame_buffer);
+}
+
+void videoout_set_scroll(uint first_line) { atomic_store(&scroll_line, first_line); }
+
+void videoout_present(void *frame_buffer, uint first_line) {
+  if (!videoout_is_running) {
+    videoout_set_frame_buffer(frame_buffer);
+    videoout_set_scroll(first_line);
+    return;
+  }
+
+  pthread_mutex_lock(&video_lock);
+  while (present_pending) {
+    pthread_cond_wait(&video_cond, &video_lock);
+  }
+  present_frame_buffer = frame_buffer;
+  present_scroll = first_line;
+  present_pending = true;
+  pthread_mutex_unlock(&video_lock);
+}
+
+void videoout_wait_for_present(void) {
+  pthread_mutex_lock(&video_lock);
+  while (present_pending) {
+    pthread_cond_wait(&video_cond, &video_lock);
+  }
+  pthread_mutex_unlock(&video_lock);
+}
+
+void videoout_wait_for_vblank(void) {
+  pthread_mutex_lock(&video_lock);
+  while (!vblank_signalled) {
+    pthread_cond_wait(&video_cond, &video_lock);
+  }
+  vblank_signalled = false;
+  pthread_mutex_unlock(&video_lock);
+}
+
+bool videoout_host_present_pending(void) {
+  pthread_mutex_lock(&video_lock);
+  bool pending = present_pending;
+  pthread_mutex_unlock(&video_lock);
+  return pending;
+}
+
+bool videoout_set_line_renderer(videoout_line_renderer_t renderer) {
+  if (videoout_is_running) {
+    return false;
+  }
+  if ((renderer != NULL) && (active_mode != NULL) &&
+      (active_mode->visible_dots_per_line > VIDEOOUT_LINE_BUFFER_MAX_DOTS)) {
+    return false;
+  }
+  line_renderer = renderer;
+  return true;
+}
+
+void videoout_set_cursor(uint x, uint y, uint width, uint height) {
+  cursor_t c = {.first_line = y, .n_lines = height};
+
+  if (x >= VIDEOOUT_LINE_BUFFER_MAX_DOTS) {
+    width = 0;
+  } else if (width > VIDEOOUT_LINE_BUFFER_MAX_DOTS - x) {
+    width = VIDEOOUT_LINE_BUFFER_MAX_DOTS - x;
+  }
+  if (height > VIDEOOUT_CURSOR_MAX_LINES) {
+    c.n_lines = VIDEOOUT_CURSOR_MAX_LINES;
+  }
+
+  if (width == 0) {
+    c.n_lines = 0;
+  } else {
+    uint end = x + width;
+    c.first_byte = x >> 2;
+    c.n_bytes = ((end + 3) >> 2) - c.first_byte;
+    c.first_mask = 0xff >> ((x & 3) << 1);
+    c.last_mask = (end & 3) ? (uint8_t)(0xff << ((4 - (end & 3)) << 1)) : 0xff;
+  }
+
+  pthread_mutex_lock(&video_lock);
+  next_cursor = c;
+  next_cursor_pending = true;
+  pthread_mutex_unlock(&video_lock);
+}
+
+void videoout_set_cursor_blink(uint period) { cursor_blink_period = period; }
+
+void videoout_set_reverse(bool reverse) { reverse_video = reverse; }
+
+void videoout_flash(uint n_fields) { flash_fields = n_fields; }
+
+// Only the frame counts and times are kept. Nothing can underflow and the handler has no latency.
+void videoout_get_stats(videoout_stats_t *stats_out) {
+  uint32_t save = save_and_disable_interrupts();
+  *stats_out = stats;
+  restore_interrupts(save);
+}
+
+void videoout_reset_stats(void) {
+  uint32_t save = save_and_disable_interrupts();
+  stats = (videoout_stats_t){0};
+  restore_interrupts(save);
+}
+
+bool videoout_host_write_pgm(const char *path) {
+  static const uint8_t levels[4] = {0, 0, 170, 255};
+
+  FILE *f = fopen(path, "wb");
+  if (f == NULL) {
+    return false;
+  }
+  uint32_t save = save_and_disable_interrupts();
+  uint width = videoout_get_screen_width(), height = videoout_get_screen_height();
+  fprintf(f, "P5\n%u %u\n255\n", width, height);
+  for (size_t i = 0; i < (size_t)width * height; i++) {
+    fputc(levels[screen[i]], f);
+  }
+  restore_interrupts(save);
+  return fclose(f) == 0;
+}
@@ -0,0 +1,10 @@
+#include "pico/types.h"
+
+// Host-only additions to videoout.h.
+
+// Write the most recently shown field as a binary PGM image, black, dim and bright being 0, 170 and
+// 255. Return false, with errno set, on failure.
+bool videoout_host_write_pgm(const char *path);
+
+// Return true if a frame buffer presented has yet to be taken at the start of a field.
+bool videoout_host_present_pending(void);
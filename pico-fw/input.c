@@ -0,0 +1,87 @@
+#include <stdatomic.h>
+
+#include "hardware/sync.h"
+#include "tusb.h"
+
+#include "arena.h"
+#include "input.h"
+
+// Received bytes. The receive callback only writes tail and the main loop only writes head. Both are
+// free-running counts, so bytes head to tail are waiting to be read.
+static char *buffer = NULL;
+static uint32_t buffer_size = 0;
+static atomic_uint head, tail;
+
+// Set if the buffer filled with data still waiting in TinyUSB. TinyUSB does not call the receive
+// callback again until more arrives, which it cannot while its own buffer is full, so the rest is
+// read once there is room.
+static volatile bool receive_pending = false;
+
+// Read as much as fits from TinyUSB into the buffer.
+static void receive(void) {
+  uint32_t t = atomic_load_explicit(&tail, memory_order_relaxed);
+  uint32_t h = atomic_load_explicit(&head, memory_order_acquire);
+
+  receive_pending = false;
+  while (tud_cdc_available() > 0) {
+    uint32_t space = buffer_size - (t - h);
+    if (space == 0) {
+      receive_pending = true;
+      break;
+    }
+
+    // Read up to the end of the buffer, wrapping on the next pass.
+    uint32_t offset = t & (buffer_size - 1);
+    uint32_t n = tud_cdc_read(buffer + offset,
+                              (space < buffer_size - offset) ? space : buffer_size - offset);
+    if (n == 0) {
+      break;
+    }
+    t += n;
+    atomic_store_explicit(&tail, t, memory_order_release);
+  }
+}
+
+// Called by TinyUSB, from the USB interrupt on core 0, when data is received.
+void tud_cdc_rx_cb(uint8_t itf) {
+  receive();
+  __sev();
+}
+
+bool input_init(size_t size) {
+  char *new_buffer = arena_realloc(buffer, size);
+  if (new_buffer == NULL) {
+    return false;
+  }
+  buffer = new_buffer;
+  buffer_size = size;
+  atomic_init(&head, 0);
+  atomic_init(&tail, 0);
+  return true;
+}
+
+size_t input_peek(const char **bytes) {
+  uint32_t h = atomic_load_explicit(&head, memory_order_relaxed);
+  uint32_t available = atomic_load_explicit(&tail, memory_order_acquire) - h;
+  uint32_t offset = h & (buffer_size - 1);
+
+  *bytes = buffer + offset;
+  return (available < buffer_size - offset) ? available : buffer_size - offset;
+}
+
+void input_consume(size_t len) {
+  uint32_t h = atomic_load_explicit(&head, memory_order_relaxed);
+  atomic_store_explicit(&head, h + len, memory_order_release);
+
+  // Nothing else uses TinyUSB while interrupts are off, as the USB interrupt is on this core.
+  if (receive_pending) {
+    uint32_t save = save_and_disable_interrupts();
+    receive();
+    restore_interrupts(save);
+  }
+}
+
+bool input_is_empty(void) {
+  return atomic_load_explicit(&head, memory_order_relaxed) ==
+         atomic_load_explicit(&tail, memory_order_acquire);
+}
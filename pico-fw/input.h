@@ -0,0 +1,21 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Input received over USB CDC. Data is read in bulk from the TinyUSB receive callback into a ring
+// buffer, which the main loop then reads in place. Each receive signals an event, so the main loop
+// can sleep in __wfe() until there is input.
+
+// Allocate a ring buffer of size bytes from the arena. size must be a power of two. Return false if
+// the buffer could not be allocated. Must be called before USB is started by stdio_init_all().
+bool input_init(size_t size);
+
+// Point bytes at the oldest received data and return how many bytes follow contiguously, or 0 if
+// nothing has been received. The data stays in place until passed to input_consume().
+size_t input_peek(const char **bytes);
+
+// Release len bytes returned by input_peek() so the space can be reused.
+void input_consume(size_t len);
+
+// Return true if nothing received is waiting to be read.
+bool input_is_empty(void);
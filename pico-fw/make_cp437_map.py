@@ -1,5 +1,158 @@
 #!/usr/bin/env python3
-import collections
+import re
+import unicodedata
+
+# Character drawn for codepoints with no CP437 equivalent.
+UNMAPPED_CHAR = ord("?")
+
+# Codepoints drawn as a similar CP437 character, given as the codepoint of that character. Box
+# drawing characters are matched separately in box_drawing_fallbacks().
+FALLBACKS = {
+    # Quotes and primes.
+    **{cp: ord("'") for cp in (0x2018, 0x2019, 0x201A, 0x201B, 0x2032, 0x2035)},
+    **{cp: ord('"') for cp in (0x201C, 0x201D, 0x201E, 0x201F, 0x2033, 0x2036)},
+    0x2039: ord("<"),
+    0x203A: ord(">"),
+    # Dashes, hyphens and minus signs.
+    **{cp: ord("-") for cp in range(0x2010, 0x2016)},
+    0x2043: ord("-"),
+    0x2212: ord("-"),
+    0x2026: ord("."),
+    # Bullets, ticks and crosses.
+    0x2023: 0x2022,
+    0x25E6: 0x25CB,
+    0x2713: 0x221A,
+    0x2714: 0x221A,
+    0x2717: ord("x"),
+    0x2718: ord("x"),
+    0x00D7: ord("x"),
+    # Arrows and triangles.
+    0x21D0: 0x2190,
+    0x21D1: 0x2191,
+    0x21D2: 0x2192,
+    0x21D3: 0x2193,
+    0x21D4: 0x2194,
+    0x21D5: 0x2195,
+    0x25B6: 0x25BA,
+    0x25B8: 0x25BA,
+    0x25B9: 0x25BA,
+    0x25C0: 0x25C4,
+    0x25C2: 0x25C4,
+    0x25C3: 0x25C4,
+    0x25B4: 0x25B2,
+    0x25B5: 0x25B2,
+    0x25BE: 0x25BC,
+    0x25BF: 0x25BC,
+    # Diagonal box drawing.
+    0x2571: ord("/"),
+    0x2572: ord("\\"),
+    0x2573: ord("X"),
+    # Block elements.
+    **{cp: 0x2584 for cp in range(0x2581, 0x2588)},
+    **{cp: 0x258C for cp in range(0x2589, 0x2590)},
+    0x2594: 0x2580,
+    0x2595: 0x2590,
+    0x2596: 0x2584,
+    0x2597: 0x2584,
+    0x2598: 0x2580,
+    0x259D: 0x2580,
+    0x2599: 0x2588,
+    0x259B: 0x2588,
+    0x259C: 0x2588,
+    0x259F: 0x2588,
+    0x259A: 0x2592,
+    0x259E: 0x2592,
+    0x25AA: 0x25A0,
+    0x25FC: 0x25A0,
+    0x25FE: 0x25A0,
+}
+
+BOX_WEIGHTS = {"LIGHT": "LIGHT", "SINGLE": "LIGHT", "HEAVY": "HEAVY", "DOUBLE": "DOUBLE"}
+BOX_ARMS = {
+    "UP": ("UP",),
+    "DOWN": ("DOWN",),
+    "LEFT": ("LEFT",),
+    "RIGHT": ("RIGHT",),
+    "VERTICAL": ("UP", "DOWN"),
+    "HORIZONTAL": ("LEFT", "RIGHT"),
+}
+
+# Cost of drawing a line of one weight with another. Heavy lines are drawn as single lines, which
+# keeps their joins with light lines intact.
+WEIGHT_COST = {
+    ("LIGHT", "LIGHT"): 0,
+    ("HEAVY", "LIGHT"): 1,
+    ("HEAVY", "DOUBLE"): 2,
+    ("DOUBLE", "LIGHT"): 3,
+    ("LIGHT", "DOUBLE"): 3,
+    ("DOUBLE", "DOUBLE"): 0,
+}
+
+
+def box_arms(cp):
+    """Map a box drawing character to the weight of each of the lines leaving its centre."""
+    name = unicodedata.name(chr(cp), "")
+    if not name.startswith("BOX DRAWINGS ") or "DIAGONAL" in name:
+        return None
+    name = re.sub(r"\b(DOUBLE |TRIPLE |QUADRUPLE )?DASH\b|\bARC\b", "", name[len("BOX DRAWINGS ") :])
+    arms = {}
+    pending = []
+    weight = None
+    for segment in name.split(" AND "):
+        words = segment.split()
+        seg_weights = [BOX_WEIGHTS[w] for w in words if w in BOX_WEIGHTS]
+        seg_arms = [a for w in words if w in BOX_ARMS for a in BOX_ARMS[w]]
+        if seg_weights:
+            weight = seg_weights[0]
+            for a in pending + seg_arms:
+                arms[a] = weight
+            pending = []
+        elif weight is not None:
+            for a in seg_arms:
+                arms[a] = weight
+        else:
+            pending += seg_arms
+    return arms or None
+
+
+def box_drawing_fallbacks(mapped):
+    """Match each box drawing character with no CP437 equivalent to the closest one that has."""
+    candidates = {}
+    for cp in mapped:
+        arms = box_arms(cp)
+        if arms is not None:
+            candidates[cp] = arms
+    fallbacks = {}
+    for cp in range(0x2500, 0x2580):
+        arms = box_arms(cp)
+        if (cp in mapped) or (arms is None):
+            continue
+
+        def cost(candidate):
+            c_arms = candidates[candidate]
+            c = 10 * len(set(arms) ^ set(c_arms))
+            for a in set(arms) & set(c_arms):
+                c += WEIGHT_COST[(arms[a], c_arms[a])]
+            return (c, candidate)
+
+        fallbacks[cp] = min(candidates, key=cost)
+    return fallbacks
+
+
+def fallback(cp, codepoint_to_char_map):
+    """Find a character, with a CP437 equivalent, to draw in place of one without."""
+    if cp in FALLBACKS:
+        return FALLBACKS[cp]
+    ch = chr(cp)
+    # Compatibility forms such as fullwidth letters and typographic spaces.
+    nfkc = unicodedata.normalize("NFKC", ch)
+    if (len(nfkc) == 1) and (ord(nfkc) in codepoint_to_char_map):
+        return ord(nfkc)
+    # Letters with accents CP437 does not have.
+    nfd = unicodedata.normalize("NFD", ch)
+    if (len(nfd) > 1) and unicodedata.category(ch).startswith("L"):
+        return ord(nfd[0])
+    return None
 
 
 def main():
@@ -9,24 +162,46 @@ def main():
             ch_s, _, _, cp_s = ln.split("\t")
             codepoint_to_char_map[int(cp_s, 16)] = int(ch_s)
 
-    hash_map = collections.defaultdict(list)
-    for cp, ch in codepoint_to_char_map.items():
-        if cp < 0x7f:
+    char_map = dict(codepoint_to_char_map)
+    fallbacks = box_drawing_fallbacks(codepoint_to_char_map)
+    for cp in range(0x80, 0x10000):
+        if (cp in char_map) or (0xD800 <= cp < 0xE000):
             continue
-        hash_map[cp & 0xFF].append((cp & ~0xff) | ch)
+        to = fallbacks.get(cp)
+        if to is None:
+            to = fallback(cp, codepoint_to_char_map)
+        if (to is not None) and (to in codepoint_to_char_map):
+            char_map[cp] = codepoint_to_char_map[to]
 
-    max_len = max(len(v) for v in hash_map.values())
+    # Page 0 of the table is all unmapped and shared by every page with nothing in it.
+    pages = [[UNMAPPED_CHAR] * 256]
+    page_index = [0] * 256
+    for high in range(256):
+        page = [char_map.get((high << 8) | low, UNMAPPED_CHAR) for low in range(256)]
+        if page == pages[0]:
+            continue
+        page_index[high] = len(pages)
+        pages.append(page)
 
     with open("cp437_map.h", "w") as f:
         print("#include <stdint.h>\n", file=f)
-        print(f"#define CP437_ENTRY_LEN {max_len}\n", file=f)
-        print(f"uint16_t cp437_map[][{max_len}] = {{", file=f)
-        for low in range(256):
-            vs = [0] * max_len
-            for i, v in enumerate(hash_map[low]):
-                vs[i] = v
-            vals = ", ".join(f"0x{v:04x}" for v in vs)
-            print(f"  {{{vals}}},", file=f)
+        print("// Generated by make_cp437_map.py from cp437-map.tsv.\n", file=f)
+        print("// The CP437 character for a codepoint cp in the BMP is", file=f)
+        print("// cp437_pages[cp437_page_index[cp >> 8]][cp & 0xff]. Codepoints without an", file=f)
+        print("// equivalent are mapped to a similar character or to CP437_UNMAPPED.\n", file=f)
+        print(f"#define CP437_UNMAPPED 0x{UNMAPPED_CHAR:02x}\n", file=f)
+        print("const uint8_t cp437_page_index[256] = {", file=f)
+        for i in range(0, 256, 16):
+            vals = ", ".join(f"{v}" for v in page_index[i : i + 16])
+            print(f"  {vals},", file=f)
+        print("};\n", file=f)
+        print(f"const uint8_t cp437_pages[{len(pages)}][256] = {{", file=f)
+        for page in pages:
+            print("  {", file=f)
+            for i in range(0, 256, 16):
+                vals = ", ".join(f"0x{v:02x}" for v in page[i : i + 16])
+                print(f"    {vals},", file=f)
+            print("  },", file=f)
         print("};", file=f)
 
 
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""Solve the built-in video modes for a system clock and dot clock divider and write video_modes.h.
+
+The search is the same as videoout_solve_mode() in videoout.c, and every mode is checked against
+the same rules as videoout_mode_is_valid() before it is written.
+"""
+
+# Target timings, in ns, of the built-in modes. The 720, 864 and 1024 dot modes are the 80 column
+# modes for 9, 8 (plus a wider margin) and 8 (scaled) dot fonts and the 1056 dot mode is the 132
+# column mode for an 8 dot font.
+TARGETS = [
+    dict(
+        name="720_350",
+        visible_dots_per_line=720,
+        visible_lines_per_frame=350,
+        line_period_ns=44400,
+        visible_width_ns=34560,
+        hsync_width_ns=8256,
+        lines_per_frame=375,
+        vsync_lines_per_frame=3,
+        visible_start_line=22,
+    ),
+    dict(
+        name="864_350",
+        visible_dots_per_line=864,
+        visible_lines_per_frame=350,
+        line_period_ns=44400,
+        visible_width_ns=34560,
+        hsync_width_ns=8280,
+        lines_per_frame=375,
+        vsync_lines_per_frame=3,
+        visible_start_line=22,
+    ),
+    dict(
+        name="1024_350",
+        visible_dots_per_line=1024,
+        visible_lines_per_frame=350,
+        line_period_ns=44384,
+        visible_width_ns=32768,
+        hsync_width_ns=8288,
+        lines_per_frame=375,
+        vsync_lines_per_frame=3,
+        visible_start_line=22,
+    ),
+    dict(
+        name="1056_350",
+        visible_dots_per_line=1056,
+        visible_lines_per_frame=350,
+        line_period_ns=44400,
+        visible_width_ns=34560,
+        hsync_width_ns=8256,
+        lines_per_frame=375,
+        vsync_lines_per_frame=3,
+        visible_start_line=22,
+    ),
+]
+
+# Keep in step with videoout.c.
+PLL_REF_KHZ = 12000
+PLL_VCO_MIN_KHZ = 750000
+PLL_VCO_MAX_KHZ = 1600000
+MIN_SYS_CLOCK_KHZ = 100000
+MAX_SYS_CLOCK_KHZ = 133000
+DEFAULT_SYS_CLOCK_KHZ = 125000
+
+
+def sys_clocks_khz():
+    """System clocks, in whole kHz, the system PLL can make from the crystal oscillator."""
+    clocks = set()
+    for fbdiv in range(16, 321):
+        vco_khz = PLL_REF_KHZ * fbdiv
+        if not (PLL_VCO_MIN_KHZ <= vco_khz <= PLL_VCO_MAX_KHZ):
+            continue
+        for postdiv1 in range(1, 8):
+            for postdiv2 in range(1, postdiv1 + 1):
+                if vco_khz % (postdiv1 * postdiv2) == 0:
+                    clocks.add(vco_khz // (postdiv1 * postdiv2))
+    return sorted(c for c in clocks if MIN_SYS_CLOCK_KHZ <= c <= MAX_SYS_CLOCK_KHZ)
+
+
+# Integer arithmetic rounding halves up, as in videoout.c, so both pick the same modes.
+
+
+def dots(t_ns, sys_clock_khz, sys_clocks_per_dot):
+    """Number of dots nearest to t_ns."""
+    d = sys_clocks_per_dot * 1000000
+    return (t_ns * sys_clock_khz + d // 2) // d
+
+
+def error_ps(n, t_ns, sys_clock_khz, sys_clocks_per_dot):
+    """Time of n dots less t_ns, in ps."""
+    n_ps = (n * sys_clocks_per_dot * 1000000000 + sys_clock_khz // 2) // sys_clock_khz
+    return n_ps - t_ns * 1000
+
+
+def sync_timing_dots_valid(n):
+    """True if a sync timing state of n dots fits the 14 bit cycle count of sync_timing_encode()."""
+    return 5 <= n <= 0x3FFF + 5
+
+
+def mode_is_valid(m):
+    if m["sys_clock_khz"] == 0:
+        return False
+    if not (2 <= m["sys_clocks_per_dot"] <= 0xFFFF):
+        return False
+    if (m["visible_dots_per_line"] & 0xF) != 0:
+        return False
+    if m["dots_per_line"] <= m["visible_dots_per_line"]:
+        return False
+    back_porch = m["dots_per_line"] - m["visible_dots_per_line"]
+    hsync = m["hsync_dots"]
+    if back_porch == hsync:
+        return False
+    if back_porch < hsync:
+        states = [back_porch, hsync - back_porch, 16, m["dots_per_line"] - hsync - 16]
+    else:
+        states = [hsync, back_porch - hsync, 16, m["visible_dots_per_line"] - 16]
+    states += [hsync, m["dots_per_line"] - hsync]
+    if not all(sync_timing_dots_valid(n) for n in states):
+        return False
+    if m["lines_per_frame"] <= m["vsync_lines_per_frame"] + m["vsync_lines_per_frame"]:
+        return False
+    if m["lines_per_frame"] <= m["visible_start_line"] + m["visible_lines_per_frame"]:
+        return False
+    return True
+
+
+def solve(target):
+    """Return the valid mode closest to target and its line period, visible width and hsync
+    errors in ps, or None."""
+    best = None
+    for sys_clock_khz in sys_clocks_khz():
+        d = target["visible_dots_per_line"] * 1000000
+        nearest = (target["visible_width_ns"] * sys_clock_khz + d // 2) // d
+        for sys_clocks_per_dot in (nearest - 1, nearest, nearest + 1):
+            if sys_clocks_per_dot < 2:
+                continue
+            m = dict(
+                visible_dots_per_line=target["visible_dots_per_line"],
+                visible_lines_per_frame=target["visible_lines_per_frame"],
+                sys_clock_khz=sys_clock_khz,
+                sys_clocks_per_dot=sys_clocks_per_dot,
+                dots_per_line=dots(target["line_period_ns"], sys_clock_khz, sys_clocks_per_dot),
+                lines_per_frame=target["lines_per_frame"],
+                vsync_lines_per_frame=target["vsync_lines_per_frame"],
+                visible_start_line=target["visible_start_line"],
+                hsync_dots=dots(target["hsync_width_ns"], sys_clock_khz, sys_clocks_per_dot),
+            )
+            if not mode_is_valid(m):
+                continue
+            errors = tuple(
+                error_ps(m[field], target[t_field], sys_clock_khz, sys_clocks_per_dot)
+                for field, t_field in (
+                    ("dots_per_line", "line_period_ns"),
+                    ("visible_dots_per_line", "visible_width_ns"),
+                    ("hsync_dots", "hsync_width_ns"),
+                )
+            )
+            cost = (
+                abs(errors[0]) + abs(errors[1]),
+                abs(sys_clock_khz - DEFAULT_SYS_CLOCK_KHZ),
+                sys_clock_khz > DEFAULT_SYS_CLOCK_KHZ,
+                sys_clocks_per_dot % 2,
+            )
+            if (best is None) or (cost < best[0]):
+                best = (cost, m, errors)
+    return None if best is None else best[1:]
+
+
+FIELDS = [
+    "visible_dots_per_line",
+    "visible_lines_per_frame",
+    "sys_clock_khz",
+    "sys_clocks_per_dot",
+    "dots_per_line",
+    "lines_per_frame",
+    "vsync_lines_per_frame",
+    "visible_start_line",
+    "hsync_dots",
+]
+
+
+def main():
+    with open("video_modes.h", "w") as f:
+        print("// Generated by make_video_modes.py.\n", file=f)
+        print("// Largest visible width and height of the standard modes. Define", file=f)
+        print("// VIDEO_MODES_SIZES_ONLY before including this to get only these.", file=f)
+        for field in ("visible_dots_per_line", "visible_lines_per_frame"):
+            print(
+                f"#define VIDEO_MODES_MAX_{field.upper()} {max(t[field] for t in TARGETS)}",
+                file=f,
+            )
+        print("\n#ifndef VIDEO_MODES_SIZES_ONLY\n", file=f)
+        print("// Errors are the solved line period, visible width and hsync width less the", file=f)
+        print("// target, in ps.", file=f)
+        for target in TARGETS:
+            solution = solve(target)
+            if solution is None:
+                raise SystemExit(f"no valid mode for {target['name']}")
+            m, errors = solution
+            print(
+                f"\n// Errors {errors[0]}, {errors[1]} and {errors[2]} ps.\n"
+                f"videoout_mode_t videoout_mode_{target['name']} = {{",
+                file=f,
+            )
+            for field in FIELDS:
+                print(f"    .{field} = {m[field]},", file=f)
+            print("};", file=f)
+        print("\n#endif", file=f)
+
+
+if __name__ == "__main__":
+    main()
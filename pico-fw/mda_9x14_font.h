@@ -1,4 +1,4 @@
-unsigned char mda_9x14_font[] = {
+const unsigned char mda_9x14_font[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x3f,
   0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0xff, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -0,0 +1,50 @@
+#include <string.h>
+
+#include "arena.h"
+#include "spsc_queue.h"
+
+bool spsc_queue_init(spsc_queue_t *queue, size_t entry_size, uint32_t capacity) {
+  uint8_t *entries = arena_realloc(queue->entries, entry_size * capacity);
+  if (entries == NULL) {
+    return false;
+  }
+  queue->entries = entries;
+  queue->entry_size = entry_size;
+  queue->capacity = capacity;
+  atomic_init(&queue->head, 0);
+  atomic_init(&queue->tail, 0);
+  return true;
+}
+
+void spsc_queue_push(spsc_queue_t *queue, const void *entry) {
+  uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+  // The consumer always empties the queue so this only waits while it catches up.
+  while (tail - atomic_load_explicit(&queue->head, memory_order_acquire) >= queue->capacity) {
+  }
+
+  memcpy(queue->entries + (tail & (queue->capacity - 1)) * queue->entry_size, entry,
+         queue->entry_size);
+
+  // The entry is written before the consumer can see it.
+  atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+}
+
+bool spsc_queue_pop(spsc_queue_t *queue, void *entry) {
+  uint32_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  if (head == atomic_load_explicit(&queue->tail, memory_order_acquire)) {
+    return false;
+  }
+
+  memcpy(entry, queue->entries + (head & (queue->capacity - 1)) * queue->entry_size,
+         queue->entry_size);
+
+  // The entry is read before the producer can reuse it.
+  atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+  return true;
+}
+
+bool spsc_queue_is_empty(spsc_queue_t *queue) {
+  return atomic_load_explicit(&queue->head, memory_order_relaxed) ==
+         atomic_load_explicit(&queue->tail, memory_order_acquire);
+}
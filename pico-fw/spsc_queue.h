@@ -0,0 +1,29 @@
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A queue of fixed-size entries passed from one producer to one consumer, such as from one core to
+// the other, without locks. The producer only writes tail and the consumer only writes head.
+typedef struct {
+  uint8_t *entries;
+  size_t entry_size;
+  uint32_t capacity; // a power of two
+
+  // Free-running counts of entries popped and pushed. Entries head to tail are queued.
+  atomic_uint head, tail;
+} spsc_queue_t;
+
+// Allocate room for capacity entries of entry_size bytes from the arena. capacity must be a power
+// of two. Return false if the entries could not be allocated.
+bool spsc_queue_init(spsc_queue_t *queue, size_t entry_size, uint32_t capacity);
+
+// Copy an entry onto the queue, first waiting for the consumer to make room if it is full. Only
+// called by the producer.
+void spsc_queue_push(spsc_queue_t *queue, const void *entry);
+
+// Copy the oldest entry off the queue. Return false if it is empty. Only called by the consumer.
+bool spsc_queue_pop(spsc_queue_t *queue, void *entry);
+
+// Return true if nothing is queued.
+bool spsc_queue_is_empty(spsc_queue_t *queue);
@@ -0,0 +1,117 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Terminal emulation backend. Exactly one of term_vterm.c (libvterm), term_tsm.c (libtsm) or
+// term_tmt.c (libtmt) is built, chosen with the FIRMWARE_TERM_BACKEND CMake option. The backend
+// parses input, holds the screen and reports changes to it through term_callbacks_t.
+
+// Lines of scrollback kept by backends which support it (libtsm).
+#ifndef TERM_SCROLLBACK_LINES
+#define TERM_SCROLLBACK_LINES 0
+#endif
+
+// Bytes of backend storage per screen cell and per scrollback line of n_cols cells, used to size
+// the arena. libtsm keeps cells for both the main and alternate screens.
+#if defined(TERM_BACKEND_TSM)
+#define TERM_CELL_SIZE 48
+#define TERM_SCROLLBACK_LINE_SIZE(n_cols) (64 + ((n_cols) * 24))
+#elif defined(TERM_BACKEND_TMT)
+#define TERM_CELL_SIZE 20
+#elif defined(VTERM_COMPACT_CELLS)
+#define TERM_CELL_SIZE 8
+#else
+#define TERM_CELL_SIZE 36
+#endif
+#ifndef TERM_SCROLLBACK_LINE_SIZE
+#define TERM_SCROLLBACK_LINE_SIZE(n_cols) 0
+#endif
+
+typedef struct {
+  int row, col;
+} term_pos_t;
+
+// Rows start_row to end_row and columns start_col to end_col, both end exclusive.
+typedef struct {
+  int start_row, end_row, start_col, end_col;
+} term_rect_t;
+
+#define TERM_COLOR_INDEXED 0
+#define TERM_COLOR_RGB 1
+
+#define TERM_CURSOR_SHAPE_BLOCK 0
+#define TERM_CURSOR_SHAPE_UNDERLINE 1
+#define TERM_CURSOR_SHAPE_BAR 2
+
+// A colour as either an index into the backend's palette or as RGB.
+typedef struct {
+  uint8_t type;
+  uint8_t idx;
+  uint8_t red, green, blue;
+} term_color_t;
+
+typedef struct {
+  // Codepoint, 0 for an empty cell or (uint32_t)-1 for the right half of a wide character.
+  uint32_t ch;
+  term_color_t fg, bg;
+  bool reverse;
+} term_cell_t;
+
+typedef struct {
+  // Cells in rect have changed.
+  void (*damage)(term_rect_t rect);
+
+  // Cells in src have moved to dest. Return false to have dest damaged instead. Optional and only
+  // called by backends which track moves.
+  bool (*move_rect)(term_rect_t dest, term_rect_t src);
+
+  void (*move_cursor)(term_pos_t pos, term_pos_t old_pos, bool visible);
+  void (*set_cursor_visible)(bool visible);
+
+  // The cursor is to be shown as shape, one of TERM_CURSOR_SHAPE_*, and blink or not, as set by
+  // DECSCUSR. Optional and only called by backends which support it.
+  void (*set_cursor_shape)(int shape, bool blink);
+
+  // The whole screen is to be shown in reverse video, or not. Optional and only called by backends
+  // which can leave it to the caller. Other backends reverse the cells themselves.
+  void (*set_reverse)(bool reverse);
+
+  // The bell character was received. Optional.
+  void (*bell)(void);
+
+  // Bytes to send back to the host, such as replies to status requests.
+  void (*output)(const char *bytes, size_t len);
+
+  // A fragment of an OSC string the backend does not handle itself. Optional and only called by
+  // backends which pass unknown OSCs on.
+  void (*osc)(int command, const char *str, size_t len, bool initial, bool final);
+} term_callbacks_t;
+
+// Create a terminal of the given size, reset to its initial state. All allocations are made from
+// the arena.
+void term_init(int n_rows, int n_cols, const term_callbacks_t *callbacks);
+
+void term_set_size(int n_rows, int n_cols);
+void term_get_size(int *n_rows, int *n_cols);
+
+// Parse bytes received from the host.
+void term_input_write(const char *bytes, size_t len);
+
+// Report any damage, moves and cursor changes held back by the backend through the callbacks.
+void term_flush_damage(void);
+
+// Read columns start_col to end_col (exclusive) of a row into cells.
+void term_get_row(int row, int start_col, int end_col, term_cell_t *cells);
+
+// Scroll the view n lines back into the scrollback, or forward if n is negative, and damage the
+// screen. Input returns the view to the live screen. Ignored by backends without scrollback.
+void term_scroll_view(int n);
+
+// Set the colours of cells with the default foreground and background.
+void term_set_default_colors(const term_color_t *fg, const term_color_t *bg);
+
+// Replace a palette entry with an RGB colour. Return false if the backend cannot.
+bool term_set_palette_color(int idx, const term_color_t *color);
+
+// Convert an indexed colour to RGB using the backend's palette. RGB colours are left unchanged.
+void term_color_to_rgb(term_color_t *color);
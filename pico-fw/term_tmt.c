@@ -0,0 +1,183 @@
+#include <string.h>
+#include <wchar.h>
+
+#include "tmt.h"
+
+#include "term.h"
+
+static TMT *vt;
+static const term_callbacks_t *callbacks;
+
+static term_pos_t cursor_pos;
+static bool cursor_visible = true;
+static term_color_t default_fg, default_bg;
+
+// The CP437 characters libtmt's alternate character set is drawn with, given as Unicode. The order
+// is that of the table in tacs() in tmt.c.
+static const wchar_t acs_chars[] = L"\u25BA\u25C4\u2191\u2193\u2588\u2666\u2592\u00B0"
+                                   L"\u00B1\u2591\u2518\u2510\u250C\u2514\u253C~"
+                                   L"\u2500\u2500\u2500_\u251C\u2524\u2534\u252C"
+                                   L"\u2502\u2264\u2265\u03C0\u256A\u00A3\u25A0";
+
+// libtmt has the eight ANSI colours only. These match libvterm's.
+static const uint8_t ansi_colors[8][3] = {
+    {0, 0, 0},     {224, 0, 0},   {0, 224, 0},   {224, 224, 0},
+    {0, 0, 224},   {224, 0, 224}, {0, 224, 224}, {224, 224, 224},
+};
+
+// libtmt decodes input with mbrtowc(), which only decodes UTF-8 if the C library supports multibyte
+// locales and one is set. tmt.c is built with mbrtowc() pointed at this instead, which always
+// decodes UTF-8. libtmt passes every byte of the pending character each time, so no state is kept.
+// Returns the length of the character, (size_t)-2 if s is the start of one or (size_t)-1 if it is
+// invalid, including overlong forms and surrogates.
+size_t term_tmt_mbrtowc(wchar_t *pwc, const char *s, size_t n, mbstate_t *ps) {
+  const unsigned char *p = (const unsigned char *)s;
+  if (n == 0) {
+    return (size_t)-2;
+  }
+
+  // Length and value bits of the lead byte and the range of the second byte, which rules out
+  // overlong forms, surrogates and codepoints past U+10FFFF as soon as it is seen.
+  size_t len;
+  uint32_t cp;
+  unsigned char min = 0x80, max = 0xbf;
+  if (p[0] < 0x80) {
+    len = 1;
+    cp = p[0];
+  } else if ((p[0] >= 0xc2) && (p[0] <= 0xdf)) {
+    len = 2;
+    cp = p[0] & 0x1f;
+  } else if ((p[0] >= 0xe0) && (p[0] <= 0xef)) {
+    len = 3;
+    cp = p[0] & 0x0f;
+    min = (p[0] == 0xe0) ? 0xa0 : 0x80;
+    max = (p[0] == 0xed) ? 0x9f : 0xbf;
+  } else if ((p[0] >= 0xf0) && (p[0] <= 0xf4)) {
+    len = 4;
+    cp = p[0] & 0x07;
+    min = (p[0] == 0xf0) ? 0x90 : 0x80;
+    max = (p[0] == 0xf4) ? 0x8f : 0xbf;
+  } else {
+    return (size_t)-1;
+  }
+
+  for (size_t i = 1; i < len; i++) {
+    if (i == n) {
+      return (size_t)-2;
+    }
+    if ((p[i] < min) || (p[i] > max)) {
+      return (size_t)-1;
+    }
+    cp = (cp << 6) | (p[i] & 0x3f);
+    min = 0x80;
+    max = 0xbf;
+  }
+
+  if (pwc != NULL) {
+    *pwc = cp;
+  }
+  return (cp == 0) ? 0 : len;
+}
+
+static term_color_t from_tmt_color(tmt_color_t color, const term_color_t *default_color) {
+  if ((color < TMT_COLOR_BLACK) || (color >= TMT_COLOR_MAX)) {
+    return *default_color;
+  }
+  return (term_color_t){.type = TERM_COLOR_INDEXED, .idx = color - TMT_COLOR_BLACK};
+}
+
+static void tmt_callback(tmt_msg_t m, TMT *vt, const void *a, void *p) {
+  switch (m) {
+  case TMT_MSG_ANSWER:
+    callbacks->output(a, strlen(a));
+    break;
+  case TMT_MSG_CURSOR:
+    cursor_visible = *(const char *)a == 't';
+    callbacks->set_cursor_visible(cursor_visible);
+    break;
+  case TMT_MSG_BELL:
+    if (callbacks->bell != NULL) {
+      callbacks->bell();
+    }
+    break;
+  default:
+    // Screen updates and cursor moves are picked up by term_flush_damage().
+    break;
+  }
+}
+
+void term_init(int n_rows, int n_cols, const term_callbacks_t *cbs) {
+  callbacks = cbs;
+  default_fg = (term_color_t){.type = TERM_COLOR_RGB, .red = 255, .green = 255, .blue = 255};
+  default_bg = (term_color_t){.type = TERM_COLOR_RGB};
+  vt = tmt_open(n_rows, n_cols, tmt_callback, NULL, acs_chars);
+}
+
+void term_set_size(int n_rows, int n_cols) { tmt_resize(vt, n_rows, n_cols); }
+
+void term_get_size(int *n_rows, int *n_cols) {
+  const TMTSCREEN *screen = tmt_screen(vt);
+  *n_rows = screen->nline;
+  *n_cols = screen->ncol;
+}
+
+void term_input_write(const char *bytes, size_t len) {
+  // A length of 0 has libtmt take the length with strlen().
+  if (len > 0) {
+    tmt_write(vt, bytes, len);
+  }
+}
+
+void term_flush_damage(void) {
+  const TMTSCREEN *screen = tmt_screen(vt);
+  for (size_t row = 0; row < screen->nline; ++row) {
+    if (screen->lines[row]->dirty) {
+      callbacks->damage((term_rect_t){
+          .start_row = row, .end_row = row + 1, .start_col = 0, .end_col = screen->ncol});
+    }
+  }
+  tmt_clean(vt);
+
+  // The cursor sits one past the last row or column until the next character is written.
+  const TMTPOINT *c = tmt_cursor(vt);
+  term_pos_t pos = {.row = (c->r < screen->nline) ? c->r : screen->nline - 1,
+                    .col = (c->c < screen->ncol) ? c->c : screen->ncol - 1};
+  if ((pos.row != cursor_pos.row) || (pos.col != cursor_pos.col)) {
+    term_pos_t old_pos = cursor_pos;
+    cursor_pos = pos;
+    callbacks->move_cursor(pos, old_pos, cursor_visible);
+  }
+}
+
+void term_scroll_view(int n) {}
+
+void term_get_row(int row, int start_col, int end_col, term_cell_t *cells) {
+  const TMTCHAR *chars = tmt_screen(vt)->lines[row]->chars;
+  for (int col = start_col; col < end_col; ++col, ++cells) {
+    const TMTCHAR *c = &chars[col];
+    cells->ch = c->c;
+    cells->fg = from_tmt_color(c->a.fg, &default_fg);
+    cells->bg = from_tmt_color(c->a.bg, &default_bg);
+    cells->reverse = c->a.reverse;
+  }
+}
+
+void term_set_default_colors(const term_color_t *fg, const term_color_t *bg) {
+  default_fg = *fg;
+  default_bg = *bg;
+  int n_rows, n_cols;
+  term_get_size(&n_rows, &n_cols);
+  callbacks->damage(
+      (term_rect_t){.start_row = 0, .end_row = n_rows, .start_col = 0, .end_col = n_cols});
+}
+
+bool term_set_palette_color(int idx, const term_color_t *color) { return false; }
+
+void term_color_to_rgb(term_color_t *color) {
+  if (color->type != TERM_COLOR_INDEXED) {
+    return;
+  }
+  const uint8_t *rgb = ansi_colors[color->idx & 0x7];
+  *color = (term_color_t){
+      .type = TERM_COLOR_RGB, .red = rgb[0], .green = rgb[1], .blue = rgb[2]};
+}
@@ -0,0 +1,190 @@
+#include "libtsm.h"
+
+#include "arena.h"
+#include "term.h"
+
+// Colour codes libtsm uses for the default foreground and background.
+#define TSM_COLOR_FOREGROUND 16
+#define TSM_COLOR_BACKGROUND 17
+
+static struct tsm_screen *screen;
+static struct tsm_vte *vte;
+static const term_callbacks_t *callbacks;
+static int n_rows, n_cols;
+
+// libtsm ages each cell, line and the screen as they change rather than reporting damage. Cells
+// newer than the age returned by the last tsm_screen_draw() are damaged when damage is flushed and
+// the rest are skipped. An age of 0 has every cell treated as changed.
+static tsm_age_t drawn_age = 0;
+
+// Lines the view is scrolled back into the scrollback, 0 for the live screen.
+static int view_offset = 0;
+
+// Scratch space for one row of cells read from libtsm.
+static struct tsm_screen_cell *row_cells = NULL;
+
+// Cells damaged so far in the current row while drawing, merged into one rectangle.
+static term_rect_t damage_run;
+
+static term_pos_t cursor_pos;
+static bool cursor_visible = true;
+static term_color_t default_fg, default_bg;
+
+static void tsm_output(struct tsm_vte *vte, const char *u8, size_t len, void *data) {
+  callbacks->output(u8, len);
+}
+
+// libtsm hands over each OSC whole. Pass on those which start with a command number.
+static void tsm_osc(struct tsm_vte *vte, const char *u8, size_t len, void *data) {
+  if (callbacks->osc == NULL) {
+    return;
+  }
+  int command = 0;
+  size_t i = 0;
+  for (; (i < len) && (u8[i] >= '0') && (u8[i] <= '9') && (command < 100000); ++i) {
+    command = (command * 10) + (u8[i] - '0');
+  }
+  if ((i == 0) || ((i < len) && (u8[i] != ';'))) {
+    return;
+  }
+  if (i < len) {
+    ++i;
+  }
+  callbacks->osc(command, u8 + i, len - i, true, true);
+}
+
+static term_color_t from_tsm_color(int8_t code, uint8_t r, uint8_t g, uint8_t b) {
+  if (code == TSM_COLOR_FOREGROUND) {
+    return default_fg;
+  }
+  if (code == TSM_COLOR_BACKGROUND) {
+    return default_bg;
+  }
+  // libtsm always fills in the RGB value so term_color_to_rgb() needs no palette of its own.
+  return (term_color_t){.type = (code >= 0) ? TERM_COLOR_INDEXED : TERM_COLOR_RGB,
+                        .idx = (code >= 0) ? code : 0,
+                        .red = r,
+                        .green = g,
+                        .blue = b};
+}
+
+static void flush_damage_run(void) {
+  if (damage_run.end_col > damage_run.start_col) {
+    callbacks->damage(damage_run);
+  }
+  damage_run.start_col = damage_run.end_col = 0;
+}
+
+// Called by tsm_screen_draw() for every cell on the screen. Only the age is looked at, the cells
+// themselves are read with term_get_row() once they are drawn.
+static int damage_cell(struct tsm_screen *con, uint32_t id, const uint32_t *ch, size_t len,
+                       unsigned int width, unsigned int posx, unsigned int posy,
+                       const struct tsm_screen_attr *attr, tsm_age_t age, void *data) {
+  if ((age != 0) && (drawn_age != 0) && (age <= drawn_age)) {
+    return 0;
+  }
+
+  if ((posy != damage_run.start_row) || (posx != damage_run.end_col)) {
+    flush_damage_run();
+    damage_run = (term_rect_t){
+        .start_row = posy, .end_row = posy + 1, .start_col = posx, .end_col = posx + 1};
+  } else {
+    damage_run.end_col++;
+  }
+  return 0;
+}
+
+static void update_cursor(void) {
+  // Clamped as tsm_screen_draw() does, as the cursor may be just past the last column.
+  term_pos_t pos = {.row = tsm_screen_get_cursor_y(screen),
+                    .col = tsm_screen_get_cursor_x(screen)};
+  pos.row = (pos.row < n_rows) ? pos.row : n_rows - 1;
+  pos.col = (pos.col < n_cols) ? pos.col : n_cols - 1;
+  // The cursor is not shown while looking at the scrollback.
+  bool visible = !(tsm_screen_get_flags(screen) & TSM_SCREEN_HIDE_CURSOR) && (view_offset == 0);
+
+  if ((pos.row != cursor_pos.row) || (pos.col != cursor_pos.col) || (visible != cursor_visible)) {
+    term_pos_t old_pos = cursor_pos;
+    cursor_pos = pos;
+    cursor_visible = visible;
+    callbacks->move_cursor(pos, old_pos, visible);
+  }
+}
+
+void term_init(int rows, int cols, const term_callbacks_t *cbs) {
+  callbacks = cbs;
+  default_fg = (term_color_t){.type = TERM_COLOR_RGB, .red = 255, .green = 255, .blue = 255};
+  default_bg = (term_color_t){.type = TERM_COLOR_RGB};
+  tsm_screen_new(&screen, NULL, NULL);
+  tsm_vte_new(&vte, screen, tsm_output, NULL, NULL, NULL);
+  tsm_vte_set_osc_cb(vte, tsm_osc, NULL);
+  tsm_screen_set_max_sb(screen, TERM_SCROLLBACK_LINES);
+  term_set_size(rows, cols);
+  tsm_vte_hard_reset(vte);
+}
+
+void term_set_size(int rows, int cols) {
+  tsm_screen_resize(screen, cols, rows);
+  n_rows = rows;
+  n_cols = cols;
+  row_cells = arena_realloc(row_cells, sizeof(row_cells[0]) * n_cols);
+  drawn_age = 0;
+}
+
+void term_get_size(int *rows, int *cols) {
+  *rows = n_rows;
+  *cols = n_cols;
+}
+
+void term_input_write(const char *bytes, size_t len) {
+  // New output returns the view to the live screen.
+  if (view_offset != 0) {
+    term_scroll_view(-view_offset);
+  }
+  tsm_vte_input(vte, bytes, len);
+}
+
+// libtsm does not say how much scrollback there is so the offset may run past the first line, in
+// which case the view stays on the first line.
+void term_scroll_view(int n) {
+  int offset = view_offset + n;
+  offset = (offset < 0) ? 0 : offset;
+  offset = (offset > TERM_SCROLLBACK_LINES) ? TERM_SCROLLBACK_LINES : offset;
+  if (offset > view_offset) {
+    tsm_screen_sb_up(screen, offset - view_offset);
+  } else if (offset < view_offset) {
+    tsm_screen_sb_down(screen, view_offset - offset);
+  }
+  view_offset = offset;
+}
+
+void term_flush_damage(void) {
+  update_cursor();
+  damage_run = (term_rect_t){.start_row = -1};
+  drawn_age = tsm_screen_draw(screen, damage_cell, NULL);
+  flush_damage_run();
+}
+
+void term_get_row(int row, int start_col, int end_col, term_cell_t *out) {
+  tsm_screen_get_row(screen, row, start_col, end_col, row_cells);
+
+  for (int col = start_col; col < end_col; ++col, ++out) {
+    const struct tsm_screen_cell *cell = &row_cells[col - start_col];
+    const struct tsm_screen_attr *attr = &cell->attr;
+    out->ch = (cell->width == 0) ? (uint32_t)-1 : cell->ch;
+    out->fg = from_tsm_color(attr->fccode, attr->fr, attr->fg, attr->fb);
+    out->bg = from_tsm_color(attr->bccode, attr->br, attr->bg, attr->bb);
+    out->reverse = attr->inverse;
+  }
+}
+
+void term_set_default_colors(const term_color_t *fg, const term_color_t *bg) {
+  default_fg = *fg;
+  default_bg = *bg;
+  drawn_age = 0;
+}
+
+// libtsm only has a choice of fixed palettes.
+bool term_set_palette_color(int idx, const term_color_t *color) { return false; }
+
+void term_color_to_rgb(term_color_t *color) { color->type = TERM_COLOR_RGB; }
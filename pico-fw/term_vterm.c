@@ -0,0 +1,199 @@
+#include "vterm.h"
+
+#include "arena.h"
+#include "term.h"
+
+static VTerm *vt;
+static VTermScreen *vt_screen;
+static VTermState *vt_state;
+static const term_callbacks_t *callbacks;
+
+// Scratch space for one row of cells read from libvterm.
+static VTermScreenRowCell *row_cells = NULL;
+
+static void *term_arena_alloc(size_t size, void *allocdata) { return arena_alloc(size); }
+static void term_arena_free(void *ptr, void *allocdata) { arena_free(ptr); }
+
+static VTermAllocatorFunctions term_allocator = {
+    .malloc = term_arena_alloc,
+    .free = term_arena_free,
+};
+
+static term_rect_t from_vterm_rect(VTermRect rect) {
+  return (term_rect_t){.start_row = rect.start_row,
+                       .end_row = rect.end_row,
+                       .start_col = rect.start_col,
+                       .end_col = rect.end_col};
+}
+
+static term_color_t from_vterm_color(const VTermColor *color) {
+  if (VTERM_COLOR_IS_INDEXED(color)) {
+    return (term_color_t){.type = TERM_COLOR_INDEXED, .idx = color->indexed.idx};
+  }
+  return (term_color_t){.type = TERM_COLOR_RGB,
+                        .red = color->rgb.red,
+                        .green = color->rgb.green,
+                        .blue = color->rgb.blue};
+}
+
+static VTermColor to_vterm_color(const term_color_t *color) {
+  VTermColor out;
+  if (color->type == TERM_COLOR_INDEXED) {
+    vterm_color_indexed(&out, color->idx);
+  } else {
+    vterm_color_rgb(&out, color->red, color->green, color->blue);
+  }
+  return out;
+}
+
+static void vt_output(const char *s, size_t len, void *user) { callbacks->output(s, len); }
+
+static int vt_damage(VTermRect rect, void *user) {
+  callbacks->damage(from_vterm_rect(rect));
+  return 1;
+}
+
+static int vt_moverect(VTermRect dest, VTermRect src, void *user) {
+  if (callbacks->move_rect == NULL) {
+    return 0;
+  }
+  return callbacks->move_rect(from_vterm_rect(dest), from_vterm_rect(src)) ? 1 : 0;
+}
+
+static int vt_movecursor(VTermPos pos, VTermPos oldpos, int visible, void *user) {
+  callbacks->move_cursor((term_pos_t){.row = pos.row, .col = pos.col},
+                         (term_pos_t){.row = oldpos.row, .col = oldpos.col}, !!visible);
+  return 1;
+}
+
+// libvterm sets the cursor shape and blink as separate properties, so the last of each is kept to
+// report both together.
+static int cursor_shape = TERM_CURSOR_SHAPE_BLOCK;
+static bool cursor_blink = true;
+
+static int vt_settermprop(VTermProp prop, VTermValue *val, void *user) {
+  switch (prop) {
+  case VTERM_PROP_CURSORVISIBLE:
+    callbacks->set_cursor_visible(!!val->boolean);
+    break;
+  case VTERM_PROP_CURSORBLINK:
+  case VTERM_PROP_CURSORSHAPE:
+    if (prop == VTERM_PROP_CURSORBLINK) {
+      cursor_blink = !!val->boolean;
+    } else if (val->number == VTERM_PROP_CURSORSHAPE_UNDERLINE) {
+      cursor_shape = TERM_CURSOR_SHAPE_UNDERLINE;
+    } else if (val->number == VTERM_PROP_CURSORSHAPE_BAR_LEFT) {
+      cursor_shape = TERM_CURSOR_SHAPE_BAR;
+    } else {
+      cursor_shape = TERM_CURSOR_SHAPE_BLOCK;
+    }
+    if (callbacks->set_cursor_shape != NULL) {
+      callbacks->set_cursor_shape(cursor_shape, cursor_blink);
+    }
+    break;
+  case VTERM_PROP_REVERSE:
+    if (callbacks->set_reverse != NULL) {
+      callbacks->set_reverse(!!val->boolean);
+    }
+    break;
+  default:
+    break;
+  }
+  return 1;
+}
+
+static int vt_bell(void *user) {
+  if (callbacks->bell != NULL) {
+    callbacks->bell();
+  }
+  return 1;
+}
+
+static VTermScreenCallbacks vt_screen_cbs = {
+    .damage = vt_damage,
+    .moverect = vt_moverect,
+    .movecursor = vt_movecursor,
+    .settermprop = vt_settermprop,
+    .bell = vt_bell,
+};
+
+static int vt_osc(int command, VTermStringFragment frag, void *user) {
+  if (callbacks->osc == NULL) {
+    return 0;
+  }
+  callbacks->osc(command, frag.str, frag.len, frag.initial, frag.final);
+  return 1;
+}
+
+static VTermStateFallbacks vt_fallbacks = {
+    .osc = vt_osc,
+};
+
+void term_init(int n_rows, int n_cols, const term_callbacks_t *cbs) {
+  callbacks = cbs;
+  vt = vterm_new_with_allocator(n_rows, n_cols, &term_allocator, NULL);
+  vterm_output_set_callback(vt, vt_output, NULL);
+  vterm_set_utf8(vt, 1);
+  row_cells = arena_realloc(row_cells, sizeof(row_cells[0]) * n_cols);
+
+  vt_screen = vterm_obtain_screen(vt);
+  vterm_screen_set_callbacks(vt_screen, &vt_screen_cbs, NULL);
+  vterm_screen_set_unrecognised_fallbacks(vt_screen, &vt_fallbacks, NULL);
+  vterm_screen_set_damage_merge(vt_screen, VTERM_DAMAGE_SCROLL);
+  // Reverse video is left to the caller if it can show it without redrawing every cell.
+  vterm_screen_enable_global_reverse(vt_screen, cbs->set_reverse == NULL);
+
+  vt_state = vterm_obtain_state(vt);
+  vterm_state_reset(vt_state, 1);
+}
+
+void term_set_size(int n_rows, int n_cols) {
+  row_cells = arena_realloc(row_cells, sizeof(row_cells[0]) * n_cols);
+  vterm_set_size(vt, n_rows, n_cols);
+}
+
+void term_get_size(int *n_rows, int *n_cols) { vterm_get_size(vt, n_rows, n_cols); }
+
+void term_input_write(const char *bytes, size_t len) { vterm_input_write(vt, bytes, len); }
+
+// Damage and moves are held back by libvterm until flushed.
+void term_flush_damage(void) { vterm_screen_flush_damage(vt_screen); }
+
+// libvterm hands lines scrolled off the screen to a callback rather than keeping them.
+void term_scroll_view(int n) {}
+
+void term_get_row(int row, int start_col, int end_col, term_cell_t *cells) {
+  vterm_screen_get_row(vt_screen, row, start_col, end_col, row_cells);
+
+  for (int col = start_col; col < end_col; ++col, ++cells) {
+    VTermScreenRowCell *cell = &row_cells[col - start_col];
+    cells->ch = cell->ch;
+    cells->fg = from_vterm_color(&cell->fg);
+    cells->bg = from_vterm_color(&cell->bg);
+    cells->reverse = cell->attrs.reverse;
+  }
+}
+
+void term_set_default_colors(const term_color_t *fg, const term_color_t *bg) {
+  VTermColor vt_fg = to_vterm_color(fg), vt_bg = to_vterm_color(bg);
+  vterm_screen_set_default_colors(vt_screen, &vt_fg, &vt_bg);
+}
+
+// libvterm only keeps a settable palette for the 16 ANSI colours.
+bool term_set_palette_color(int idx, const term_color_t *color) {
+  if ((idx < 0) || (idx >= 16)) {
+    return false;
+  }
+  VTermColor vt_color = to_vterm_color(color);
+  vterm_state_set_palette_color(vt_state, idx, &vt_color);
+  return true;
+}
+
+void term_color_to_rgb(term_color_t *color) {
+  if (color->type != TERM_COLOR_INDEXED) {
+    return;
+  }
+  VTermColor vt_color = to_vterm_color(color);
+  vterm_screen_convert_color_to_rgb(vt_screen, &vt_color);
+  *color = from_vterm_color(&vt_color);
+}
@@ -0,0 +1,65 @@
+// Generated by make_video_modes.py.
+
+// Largest visible width and height of the standard modes. Define
+// VIDEO_MODES_SIZES_ONLY before including this to get only these.
+#define VIDEO_MODES_MAX_VISIBLE_DOTS_PER_LINE 1056
+#define VIDEO_MODES_MAX_VISIBLE_LINES_PER_FRAME 350
+
+#ifndef VIDEO_MODES_SIZES_ONLY
+
+// Errors are the solved line period, visible width and hsync width less the
+// target, in ps.
+
+// Errors 0, 0 and 0 ps.
+videoout_mode_t videoout_mode_720_350 = {
+    .visible_dots_per_line = 720,
+    .visible_lines_per_frame = 350,
+    .sys_clock_khz = 125000,
+    .sys_clocks_per_dot = 6,
+    .dots_per_line = 925,
+    .lines_per_frame = 375,
+    .vsync_lines_per_frame = 3,
+    .visible_start_line = 22,
+    .hsync_dots = 172,
+};
+
+// Errors 0, 0 and 0 ps.
+videoout_mode_t videoout_mode_864_350 = {
+    .visible_dots_per_line = 864,
+    .visible_lines_per_frame = 350,
+    .sys_clock_khz = 125000,
+    .sys_clocks_per_dot = 5,
+    .dots_per_line = 1110,
+    .lines_per_frame = 375,
+    .vsync_lines_per_frame = 3,
+    .visible_start_line = 22,
+    .hsync_dots = 207,
+};
+
+// Errors 0, 0 and 0 ps.
+videoout_mode_t videoout_mode_1024_350 = {
+    .visible_dots_per_line = 1024,
+    .visible_lines_per_frame = 350,
+    .sys_clock_khz = 125000,
+    .sys_clocks_per_dot = 4,
+    .dots_per_line = 1387,
+    .lines_per_frame = 375,
+    .vsync_lines_per_frame = 3,
+    .visible_start_line = 22,
+    .hsync_dots = 259,
+};
+
+// Errors 11765, -50196 and 11974 ps.
+videoout_mode_t videoout_mode_1056_350 = {
+    .visible_dots_per_line = 1056,
+    .visible_lines_per_frame = 350,
+    .sys_clock_khz = 122400,
+    .sys_clocks_per_dot = 4,
+    .dots_per_line = 1359,
+    .lines_per_frame = 375,
+    .vsync_lines_per_frame = 3,
+    .visible_start_line = 22,
+    .hsync_dots = 253,
+};
+
+#endif
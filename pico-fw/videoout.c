@@ -1,73 +1,20 @@
 #include <stdalign.h>
 #include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "hardware/clocks.h"
 #include "hardware/dma.h"
 #include "hardware/pio.h"
+#include "hardware/structs/bus_ctrl.h"
+#include "hardware/timer.h"
 #include "pico/stdlib.h"
 #include "pico/sync.h"
 
 #include "videoout.h"
 #include "videoout.pio.h"
 
-struct videoout_mode {
-  uint visible_dots_per_line;
-  uint visible_lines_per_frame;
-
-  uint line_period_ns;
-  uint lines_per_frame;
-  uint vsync_lines_per_frame;
-  uint visible_start_line;
-
-  uint hsync_width_ns;
-  uint visible_width_ns;
-};
-
-// This is tweaked slightly from the mode used by the terminal itself to slightly widen each line.
-// This lets us fit the 720 pixels in with a dot clock being a nice integer multiple of the line
-// sync clock. This reduces noise in the output.
-//
-// Note that the video modes here have been carefully chosen so that the dot clock becomes an
-// integer multiple of the 125MHz base clock of the pico. This reduces clock jitter and improves
-// picture quality.
-videoout_mode_t videoout_mode_720_350 = {
-    .visible_dots_per_line = 720,
-    .visible_lines_per_frame = 350,
-
-    .line_period_ns = 44400,
-    .lines_per_frame = 375,
-    .vsync_lines_per_frame = 3,
-    .visible_start_line = 22,
-
-    .hsync_width_ns = 8256,
-    .visible_width_ns = 34560,
-};
-
-videoout_mode_t videoout_mode_864_350 = {
-    .visible_dots_per_line = 864,
-    .visible_lines_per_frame = 350,
-
-    .line_period_ns = 44400,
-    .lines_per_frame = 375,
-    .vsync_lines_per_frame = 3,
-    .visible_start_line = 22,
-
-    .hsync_width_ns = 8280,
-    .visible_width_ns = 34560,
-};
-
-videoout_mode_t videoout_mode_1024_350 = {
-    .visible_dots_per_line = 1024,
-    .visible_lines_per_frame = 350,
-
-    .line_period_ns = 44384,
-    .lines_per_frame = 375,
-    .vsync_lines_per_frame = 3,
-    .visible_start_line = 22,
-
-    .hsync_width_ns = 8288,
-    .visible_width_ns = 32768,
-};
+#include "video_modes.h"
 
 const videoout_mode_t *default_mode = &videoout_mode_720_350;
 
@@ -75,35 +22,20 @@ static bool videoout_is_running = false;
 static const videoout_mode_t *active_mode = NULL;
 static uint video_pin_base, sync_pin_base;
 
-static inline uint mode_back_porch_width_ns(const videoout_mode_t *m) {
-  return m->line_period_ns - m->visible_width_ns;
-}
+// Crystal oscillator frequency and the range of the system PLL's VCO. Keep in step with
+// make_video_modes.py.
+#define PLL_REF_KHZ 12000
+#define PLL_VCO_MIN_KHZ 750000
+#define PLL_VCO_MAX_KHZ 1600000
 
-static inline uint mode_dot_clock_period_ns(const videoout_mode_t *m) {
-  return m->visible_width_ns / m->visible_dots_per_line;
-}
+// Range of system clocks considered by videoout_solve_mode() and the clock preferred among equally
+// good modes. Keep in step with make_video_modes.py.
+#define MIN_SYS_CLOCK_KHZ 100000
+#define DEFAULT_SYS_CLOCK_KHZ 125000
 
-static bool mode_is_valid(const videoout_mode_t *m) {
-  if (m->visible_width_ns % m->visible_dots_per_line != 0) {
-    return false;
-  }
-  if (m->line_period_ns % mode_dot_clock_period_ns(m) != 0) {
-    return false;
-  }
-  if ((m->visible_dots_per_line & 0xf) != 0) {
-    return false;
-  }
-  if (mode_back_porch_width_ns(m) == m->hsync_width_ns) {
-    return false;
-  }
-  if (m->lines_per_frame <= m->vsync_lines_per_frame + m->vsync_lines_per_frame) {
-    return false;
-  }
-  if (m->lines_per_frame <= m->visible_start_line + m->visible_lines_per_frame) {
-    return false;
-  }
-
-  return true;
+// Dots from the end of hsync to the first visible dot.
+static inline uint mode_back_porch_dots(const videoout_mode_t *m) {
+  return m->dots_per_line - m->visible_dots_per_line;
 }
 
 // Timing program for a blank line
@@ -123,49 +55,63 @@ alignas(16) uint32_t sync_timing_visible_line[4];
 
 // Must be called when video output has been stopped.
 static inline void mode_setup(const videoout_mode_t *m) {
-  uint dot_clock_period_ns = mode_dot_clock_period_ns(m);
+  uint back_porch_dots = mode_back_porch_dots(m);
 
-  sync_timing_blank_line[0] =
-      sync_timing_encode(1, 0, m->hsync_width_ns, SIDE_EFFECT_NOP, dot_clock_period_ns);
-  sync_timing_blank_line[1] = sync_timing_encode(0, 0, m->line_period_ns - m->hsync_width_ns,
-                                                 SIDE_EFFECT_NOP, dot_clock_period_ns);
+  sync_timing_blank_line[0] = sync_timing_encode(1, 0, m->hsync_dots, SIDE_EFFECT_NOP);
+  sync_timing_blank_line[1] =
+      sync_timing_encode(0, 0, m->dots_per_line - m->hsync_dots, SIDE_EFFECT_NOP);
 
-  sync_timing_vsync_line[0] =
-      sync_timing_encode(1, 1, m->hsync_width_ns, SIDE_EFFECT_NOP, dot_clock_period_ns);
-  sync_timing_vsync_line[1] = sync_timing_encode(0, 1, m->line_period_ns - m->hsync_width_ns,
-                                                 SIDE_EFFECT_NOP, dot_clock_period_ns);
+  sync_timing_vsync_line[0] = sync_timing_encode(1, 1, m->hsync_dots, SIDE_EFFECT_NOP);
+  sync_timing_vsync_line[1] =
+      sync_timing_encode(0, 1, m->dots_per_line - m->hsync_dots, SIDE_EFFECT_NOP);
 
-  if (mode_back_porch_width_ns(m) < m->hsync_width_ns) {
-    sync_timing_visible_line[0] =
-        sync_timing_encode(1, 0, mode_back_porch_width_ns(m), SIDE_EFFECT_NOP, dot_clock_period_ns);
+  if (back_porch_dots < m->hsync_dots) {
+    sync_timing_visible_line[0] = sync_timing_encode(1, 0, back_porch_dots, SIDE_EFFECT_NOP);
     sync_timing_visible_line[1] =
-        sync_timing_encode(1, 0, m->hsync_width_ns - mode_back_porch_width_ns(m),
-                           SIDE_EFFECT_SET_TRIGGER, dot_clock_period_ns);
-    sync_timing_visible_line[2] = sync_timing_encode(
-        0, 0, 16 * dot_clock_period_ns, SIDE_EFFECT_CLEAR_TRIGGER, dot_clock_period_ns);
+        sync_timing_encode(1, 0, m->hsync_dots - back_porch_dots, SIDE_EFFECT_SET_TRIGGER);
+    sync_timing_visible_line[2] = sync_timing_encode(0, 0, 16, SIDE_EFFECT_CLEAR_TRIGGER);
     sync_timing_visible_line[3] =
-        sync_timing_encode(0, 0, m->line_period_ns - m->hsync_width_ns - (16 * dot_clock_period_ns),
-                           SIDE_EFFECT_NOP, dot_clock_period_ns);
+        sync_timing_encode(0, 0, m->dots_per_line - m->hsync_dots - 16, SIDE_EFFECT_NOP);
   } else {
-    sync_timing_visible_line[0] =
-        sync_timing_encode(1, 0, m->hsync_width_ns, SIDE_EFFECT_NOP, dot_clock_period_ns);
+    sync_timing_visible_line[0] = sync_timing_encode(1, 0, m->hsync_dots, SIDE_EFFECT_NOP);
     sync_timing_visible_line[1] =
-        sync_timing_encode(1, 0, mode_back_porch_width_ns(m) - m->hsync_width_ns, SIDE_EFFECT_NOP,
-                           dot_clock_period_ns);
-    sync_timing_visible_line[2] = sync_timing_encode(0, 0, 16 * dot_clock_period_ns,
-                                                     SIDE_EFFECT_SET_TRIGGER, dot_clock_period_ns);
+        sync_timing_encode(1, 0, back_porch_dots - m->hsync_dots, SIDE_EFFECT_NOP);
+    sync_timing_visible_line[2] = sync_timing_encode(0, 0, 16, SIDE_EFFECT_SET_TRIGGER);
     sync_timing_visible_line[3] =
-        sync_timing_encode(0, 0, m->visible_width_ns - (16 * dot_clock_period_ns),
-                           SIDE_EFFECT_CLEAR_TRIGGER, dot_clock_period_ns);
+        sync_timing_encode(0, 0, m->visible_dots_per_line - 16, SIDE_EFFECT_CLEAR_TRIGGER);
   }
 }
 
 // Semaphore used to signal vblank.
 semaphore_t vblank_semaphore;
 
+// Frame buffer and scroll queued by videoout_present() to be shown from the start of the next field.
+// The semaphore is available when no present is pending. present_pending is set with release
+// ordering after the frame buffer and scroll are stored, and read with acquire ordering, since
+// videoout_present() may be called from the other core.
+semaphore_t present_semaphore;
+static atomic_bool present_pending = false;
+static void *present_frame_buffer;
+static uint present_scroll;
+
 // Current frame buffer pointer. Marked as atomic so that the ISR always gets a valid value.
 static atomic_uintptr_t frame_buffer_ptr;
 
+// Frame buffer row shown on the first visible line.
+static atomic_uint scroll_line;
+
+// Maximum number of visible lines supported by the line table.
+#define MAX_VISIBLE_LINES 400
+
+// Address of the frame buffer row shown on each visible line. The table is NULL terminated so that
+// the video DMA stops after the last visible line. Only modified at the start of a field.
+static const void *line_table[MAX_VISIBLE_LINES + 1];
+
+// Frame buffer, scroll and mode the line table was last built for.
+static uintptr_t line_table_frame_buffer = 0;
+static uint line_table_scroll = 0;
+static const videoout_mode_t *line_table_mode = NULL;
+
 // Blanking interval callback
 static videoout_vblank_callback_t vblank_callback = NULL;
 
@@ -176,15 +122,101 @@ static uint video_output_offset;
 static uint sync_timing_sm;
 static uint sync_timing_offset;
 
+// Line renderer and ring of line buffers used when generating lines on the fly.
+static videoout_line_renderer_t line_renderer = NULL;
+alignas(4) static uint8_t line_buffers[VIDEOOUT_LINE_BUFFER_COUNT]
+                                      [VIDEOOUT_LINE_BUFFER_MAX_DOTS >> 2];
+
+// Visible line currently being transferred by the video data DMA channel when generating lines on
+// the fly.
+static uint line_renderer_dma_line = 0;
+
 // Frame timing DMA channel number and config.
 static uint sync_timing_dma_channel;
 static dma_channel_config sync_timing_dma_channel_config;
 
-// Video data DMA channel number.
+// Video data DMA channel number and config.
 static uint video_dma_channel;
-
-// Phase of frame.
-static uint frame_phase = 0;
+static dma_channel_config video_dma_channel_config;
+
+// Line table DMA channel number. Each time the video data DMA channel finishes a line it chains to
+// this channel which writes the next line table entry to the video data channel's read address
+// trigger register.
+static uint line_table_dma_channel;
+
+// Frame timing control and loop DMA channel numbers. The control channel loads the timing channel
+// with each control block in turn, starting the next phase of the frame whenever the previous one
+// finishes. After the last phase the timing channel chains to the loop channel instead, which
+// points the control channel back at sync_timing_restart_blocks. So the frame timing runs without
+// the CPU.
+static uint sync_timing_control_dma_channel;
+static uint sync_timing_loop_dma_channel;
+
+// Control blocks for the frame timing DMA channel, one per phase of the frame: vsync lines, blank
+// lines before the visible lines, visible lines and blank lines after. Each is written to the
+// channel's CTRL, READ_ADDR, WRITE_ADDR and TRANS_COUNT_TRIG registers.
+#define SYNC_TIMING_N_PHASES 4
+alignas(16) static uint32_t sync_timing_control_blocks[SYNC_TIMING_N_PHASES][4];
+
+// Control block which disables the frame timing DMA channel. Its zero transfer count is a null
+// trigger so the timing channel stops rather than starting again.
+alignas(16) static uint32_t sync_timing_stop_block[4];
+
+// Control blocks loaded by the loop channel: sync_timing_control_blocks while running and
+// sync_timing_stop_block once stopping.
+static const uint32_t *volatile sync_timing_restart_blocks;
+
+// Frame timing timestamp DMA channel number. The control channel chains to it each time it loads a
+// control block, so it copies the raw timer into sync_timing_phase_start_us[] at the start of each
+// phase of the frame.
+static uint sync_timing_timestamp_dma_channel;
+alignas(16) static volatile uint32_t sync_timing_phase_start_us[SYNC_TIMING_N_PHASES];
+
+// Health counters, updated by the frame timing DMA handler and read with videoout_get_stats().
+static critical_section_t stats_lock;
+static videoout_stats_t stats;
+static uint64_t stats_latency_sum_us = 0;
+static uint32_t stats_latency_count = 0;
+
+// Time the previous frame started, for counting frames which were never handled.
+static uint32_t stats_last_frame_start_us;
+static bool stats_frame_started = false;
+
+// System clock cycles per frame and the time from the start of the frame to the first visible line,
+// in us, for the active mode.
+static uint64_t stats_frame_cycles;
+static uint32_t stats_field_deadline_us;
+
+// Cursor overlay as the range of lines and bytes within each line it covers. The first and last
+// bytes are masked to the pixels covered. videoout_set_cursor() sets next_cursor, which is taken at
+// the start of the following field.
+typedef struct {
+  uint first_line, n_lines;
+  uint first_byte, n_bytes;
+  uint8_t first_mask, last_mask;
+} cursor_t;
+
+static critical_section_t cursor_lock;
+static cursor_t cursor, next_cursor;
+static bool next_cursor_pending = false;
+
+// Reverse video requested and fields of flash remaining, and whether the output is currently
+// inverted.
+static volatile bool reverse_video = false;
+static volatile uint flash_fields = 0;
+static bool output_inverted = false;
+
+// Fields per blink phase, or zero if the cursor is shown steadily, and the current blink phase.
+static volatile uint cursor_blink_period = 0;
+static uint cursor_blink_count = 0;
+static bool cursor_blink_shown = true;
+
+// Copies of the frame buffer lines under the cursor with the cursor inverted. The line table points
+// cursor_lines[i] at these in place of the frame buffer rows at cursor_line_rows[i].
+alignas(4) static uint8_t cursor_lines[VIDEOOUT_CURSOR_MAX_LINES]
+                                      [VIDEOOUT_LINE_BUFFER_MAX_DOTS >> 2];
+static const void *cursor_line_rows[VIDEOOUT_CURSOR_MAX_LINES];
+static uint cursor_lines_first = 0, cursor_lines_count = 0;
 
 // Configure a DMA channel to copy the frame buffer into the video output PIO state machine.
 static inline dma_channel_config
@@ -210,63 +242,307 @@ static inline dma_channel_config get_sync_timing_dma_channel_config(uint dma_cha
   return c;
 }
 
-// DMA handler called when each phase of a frame timing is finished.
-static void sync_timing_dma_handler() {
+// Rebuild the line table if the frame buffer, scroll or mode has changed. Must only be called when
+// the line table DMA is idle.
+static void __not_in_flash_func(line_table_update)(void) {
+  uintptr_t frame_buffer = atomic_load(&frame_buffer_ptr);
+  uint scroll = atomic_load(&scroll_line);
+
+  if ((frame_buffer == line_table_frame_buffer) && (scroll == line_table_scroll) &&
+      (active_mode == line_table_mode)) {
+    return;
+  }
+
+  uint n_lines = active_mode->visible_lines_per_frame;
+  uint stride = videoout_get_screen_stride();
+  if (frame_buffer == 0) {
+    line_table[0] = NULL;
+  } else {
+    const uint8_t *start = (const uint8_t *)frame_buffer, *end = start + (n_lines * stride);
+    const uint8_t *row = start + ((scroll % n_lines) * stride);
+    for (uint line = 0; line < n_lines; line++) {
+      line_table[line] = row;
+      row += stride;
+      if (row == end) {
+        row = start;
+      }
+    }
+    line_table[n_lines] = NULL;
+  }
+
+  line_table_frame_buffer = frame_buffer;
+  line_table_scroll = scroll;
+  line_table_mode = active_mode;
+}
 
-  dma_channel_acknowledge_irq0(sync_timing_dma_channel);
+// Take any cursor set since the last field and advance the blink. Called at the start of each field.
+static void __not_in_flash_func(cursor_next_field)(void) {
+  critical_section_enter_blocking(&cursor_lock);
+  if (next_cursor_pending) {
+    cursor = next_cursor;
+    next_cursor_pending = false;
+    cursor_blink_count = 0;
+    cursor_blink_shown = true;
+  }
+  critical_section_exit(&cursor_lock);
 
-  if (active_mode == NULL) {
+  if (cursor_blink_period == 0) {
+    cursor_blink_shown = true;
+  } else if (++cursor_blink_count >= cursor_blink_period) {
+    cursor_blink_count = 0;
+    cursor_blink_shown = !cursor_blink_shown;
+  }
+}
+
+// Invert the video outputs, or not, for the coming field. Called at the start of each field while
+// the video output state machine is blanked and waiting for the first visible line.
+static void __not_in_flash_func(output_polarity_update)(void) {
+  bool invert = reverse_video;
+  if (flash_fields > 0) {
+    flash_fields--;
+    invert = !invert;
+  }
+  if (invert == output_inverted) {
     return;
   }
+  output_inverted = invert;
+
+  // Blanking is inverted along with the video at the pads so the program blanks with the inverse of
+  // its usual value, keeping the output black. Both places it blanks are patched and the pins set
+  // now since the state machine is already blanked.
+  uint blank_instr = pio_encode_set(pio_pins, invert ? 2 : 1);
+  pio_instance->instr_mem[video_output_offset + video_output_offset_entry_point] = blank_instr;
+  pio_instance->instr_mem[video_output_offset + video_output_offset_blank] = blank_instr;
+  pio_sm_exec(pio_instance, video_output_sm, blank_instr);
+
+  uint override = invert ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL;
+  gpio_set_outover(video_pin_base, override);
+  gpio_set_outover(video_pin_base + 1, override);
+}
+
+// Return true if the cursor is shown this field on the given visible line.
+static inline bool cursor_on_line(uint line) {
+  return cursor_blink_shown && (line - cursor.first_line < cursor.n_lines);
+}
+
+// Invert the pixels under the cursor in one line.
+static void __not_in_flash_func(cursor_invert_line)(uint8_t *line) {
+  uint8_t *p = line + cursor.first_byte;
+  if (cursor.n_bytes == 1) {
+    *p ^= cursor.first_mask & cursor.last_mask;
+    return;
+  }
+  *p++ ^= cursor.first_mask;
+  for (uint i = 2; i < cursor.n_bytes; i++) {
+    *p++ ^= 0xff;
+  }
+  *p ^= cursor.last_mask;
+}
+
+// Point the line table back at the frame buffer rows replaced by cursor_lines_apply(). Must only be
+// called when the line table DMA is idle.
+static void __not_in_flash_func(cursor_lines_restore)(void) {
+  for (uint i = 0; i < cursor_lines_count; i++) {
+    line_table[cursor_lines_first + i] = cursor_line_rows[i];
+  }
+  cursor_lines_count = 0;
+}
+
+// Point the line table at copies of the lines under the cursor with the cursor inverted. Must only
+// be called when the line table DMA is idle.
+static void __not_in_flash_func(cursor_lines_apply)(void) {
+  uint stride = videoout_get_screen_stride();
+  uint visible_lines = active_mode->visible_lines_per_frame;
+  if (!cursor_blink_shown || (cursor.n_lines == 0) || (cursor.first_line >= visible_lines) ||
+      (stride > sizeof(cursor_lines[0])) || (line_table[0] == NULL)) {
+    return;
+  }
+
+  uint n_lines = cursor.n_lines;
+  if (n_lines > visible_lines - cursor.first_line) {
+    n_lines = visible_lines - cursor.first_line;
+  }
+  for (uint i = 0; i < n_lines; i++) {
+    uint line = cursor.first_line + i;
+    cursor_line_rows[i] = line_table[line];
+    memcpy(cursor_lines[i], cursor_line_rows[i], stride);
+    cursor_invert_line(cursor_lines[i]);
+    line_table[line] = cursor_lines[i];
+  }
+  cursor_lines_first = cursor.first_line;
+  cursor_lines_count = n_lines;
+}
+
+// Configure a DMA channel to copy each 4 word control block into the frame timing DMA channel's
+// registers each time it is triggered.
+static inline dma_channel_config get_sync_timing_control_dma_channel_config(uint dma_chan) {
+  dma_channel_config c = dma_channel_get_default_config(dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, true);
+  channel_config_set_ring(&c, true, 4);
+  return c;
+}
+
+// Configure a DMA channel to copy one line table entry into the video data DMA channel each time
+// it is triggered.
+static inline dma_channel_config get_line_table_dma_channel_config(uint dma_chan) {
+  dma_channel_config c = dma_channel_get_default_config(dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  return c;
+}
+
+// Fill in one control block for the frame timing DMA channel. It repeats a timing program, aligned
+// to its size of 1 << ring_bits bytes, for n_words. Only the visible lines raise an interrupt when
+// they finish. The last phase chains to the loop channel and the others to the control channel.
+static void sync_timing_control_block_setup(uint phase, const uint32_t *program, uint ring_bits,
+                                            uint n_words) {
+  dma_channel_config c = sync_timing_dma_channel_config;
+  bool last = phase == (SYNC_TIMING_N_PHASES - 1);
+  channel_config_set_ring(&c, false, ring_bits);
+  channel_config_set_irq_quiet(&c, program != sync_timing_visible_line);
+  uint chain_to = last ? sync_timing_loop_dma_channel : sync_timing_control_dma_channel;
+  channel_config_set_chain_to(&c, chain_to);
+  sync_timing_control_blocks[phase][0] = channel_config_get_ctrl_value(&c);
+  sync_timing_control_blocks[phase][1] = (uintptr_t)program;
+  sync_timing_control_blocks[phase][2] = (uintptr_t)&pio_instance->txf[sync_timing_sm];
+  sync_timing_control_blocks[phase][3] = n_words;
+}
+
+// Build the frame timing control blocks for a mode. Must be called when video output has been
+// stopped.
+static void sync_timing_control_blocks_setup(const videoout_mode_t *m) {
+  sync_timing_control_block_setup(0, sync_timing_vsync_line, 3,
+                                  SYNC_TIMING_VSYNC_LINE_LEN * m->vsync_lines_per_frame);
+  sync_timing_control_block_setup(1, sync_timing_blank_line, 3,
+                                  SYNC_TIMING_BLANK_LINE_LEN *
+                                      (m->visible_start_line - m->vsync_lines_per_frame));
+  sync_timing_control_block_setup(2, sync_timing_visible_line, 4,
+                                  SYNC_TIMING_VISIBLE_LINE_LEN * m->visible_lines_per_frame);
+  sync_timing_control_block_setup(3, sync_timing_blank_line, 3,
+                                  SYNC_TIMING_BLANK_LINE_LEN *
+                                      (m->lines_per_frame - m->visible_start_line -
+                                       m->visible_lines_per_frame));
+}
+
+// Start the video data for the next field. Called at the start of each frame, while the vsync and
+// blank lines before the first visible line are output.
+static void __not_in_flash_func(field_start)(void) {
+  cursor_next_field();
+  output_polarity_update();
+
+  if (line_renderer != NULL) {
+    // Fill the line buffer ring and start transferring the first line of the next field. The
+    // remaining lines are started from the video data DMA handler.
+    for (uint line = 0; line < VIDEOOUT_LINE_BUFFER_COUNT; line++) {
+      line_renderer(line, line_buffers[line]);
+      if (cursor_on_line(line)) {
+        cursor_invert_line(line_buffers[line]);
+      }
+    }
+    line_renderer_dma_line = 0;
+    dma_channel_transfer_from_buffer_now(video_dma_channel, line_buffers[0],
+                                         active_mode->visible_dots_per_line >> 4);
+  } else {
+    // Flip to any presented frame buffer.
+    if (atomic_load_explicit(&present_pending, memory_order_acquire)) {
+      atomic_store(&frame_buffer_ptr, (uintptr_t)present_frame_buffer);
+      atomic_store(&scroll_line, present_scroll);
+      atomic_store_explicit(&present_pending, false, memory_order_relaxed);
+      sem_release(&present_semaphore);
+    }
+
+    // Start frame buffer transfer for the next field. Starting the line table DMA loads the
+    // address of the first visible line into the video data DMA channel which starts it.
+    cursor_lines_restore();
+    line_table_update();
+    cursor_lines_apply();
+    dma_channel_set_trans_count(video_dma_channel, active_mode->visible_dots_per_line >> 4, false);
+    dma_channel_set_read_addr(line_table_dma_channel, line_table, true);
+  }
+}
+
+// Update the health counters at the start of a frame, once the video data for the field has been
+// started. entry_us is when the frame timing DMA handler was entered.
+static void __not_in_flash_func(stats_frame_start)(uint32_t entry_us) {
+  uint32_t done_us = time_us_32();
+
+  // The timestamp channel follows the control channel, which the loop channel has just started.
+  while (dma_channel_is_busy(sync_timing_control_dma_channel) ||
+         dma_channel_is_busy(sync_timing_timestamp_dma_channel)) {
+    tight_loop_contents();
+  }
+  uint32_t start_us = sync_timing_phase_start_us[0];
+
+  uint32_t stall_mask = (1u << (PIO_FDEBUG_TXSTALL_LSB + video_output_sm)) |
+                        (1u << (PIO_FDEBUG_TXSTALL_LSB + sync_timing_sm));
+  uint32_t stalls = pio_instance->fdebug & stall_mask;
+  pio_instance->fdebug = stalls;
+
+  critical_section_enter_blocking(&stats_lock);
+
+  // Frames since the previous frame handled, to the nearest frame.
+  uint32_t n_frames = 1;
+  if (stats_frame_started) {
+    uint64_t cycles_1000 =
+        (uint64_t)(start_us - stats_last_frame_start_us) * active_mode->sys_clock_khz;
+    n_frames = (cycles_1000 + (stats_frame_cycles * 500)) / (stats_frame_cycles * 1000);
+    if (n_frames > 1) {
+      stats.missed_frames += n_frames - 1;
+    }
+  }
+  stats_last_frame_start_us = start_us;
+  stats_frame_started = true;
+  stats.frames += n_frames;
+
+  memcpy(stats.phase_start_us, (const void *)sync_timing_phase_start_us,
+         sizeof(stats.phase_start_us));
+
+  uint32_t latency_us = entry_us - start_us;
+  if ((stats_latency_count == 0) || (latency_us < stats.latency_min_us)) {
+    stats.latency_min_us = latency_us;
+  }
+  if (latency_us > stats.latency_max_us) {
+    stats.latency_max_us = latency_us;
+  }
+  stats_latency_sum_us += latency_us;
+  stats_latency_count++;
+
+  if (done_us - start_us >= stats_field_deadline_us) {
+    stats.late_fields++;
+  }
+  if ((stalls & (1u << (PIO_FDEBUG_TXSTALL_LSB + video_output_sm))) != 0) {
+    stats.video_underflows++;
+  }
+  if ((stalls & (1u << (PIO_FDEBUG_TXSTALL_LSB + sync_timing_sm))) != 0) {
+    stats.sync_underflows++;
+  }
+
+  critical_section_exit(&stats_lock);
+}
 
-  switch (frame_phase) {
-  case 0:
-    if (!videoout_is_running) {
-      break;
+// DMA handler for the frame timing. The loop channel raises it at the start of each frame and the
+// frame timing channel at the end of the visible lines. The frame timing itself carries on
+// regardless of how promptly it runs.
+static void __not_in_flash_func(sync_timing_dma_handler)() {
+  uint32_t entry_us = time_us_32();
+
+  if (dma_channel_get_irq0_status(sync_timing_loop_dma_channel)) {
+    dma_channel_acknowledge_irq0(sync_timing_loop_dma_channel);
+    if ((active_mode != NULL) && videoout_is_running) {
+      field_start();
+      stats_frame_start(entry_us);
     }
+  }
+
+  if (dma_channel_get_irq0_status(sync_timing_dma_channel)) {
+    dma_channel_acknowledge_irq0(sync_timing_dma_channel);
 
-    // VSYNC
-    channel_config_set_ring(&sync_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(sync_timing_dma_channel, &sync_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(sync_timing_dma_channel, sync_timing_vsync_line,
-                                         SYNC_TIMING_VSYNC_LINE_LEN *
-                                             active_mode->vsync_lines_per_frame);
-
-    // Start frame buffer transfer for the next field.
-    dma_channel_transfer_from_buffer_now(video_dma_channel, (void *)atomic_load(&frame_buffer_ptr),
-                                         active_mode->visible_lines_per_frame *
-                                             (active_mode->visible_dots_per_line >> 4));
-
-    frame_phase = 1;
-    break;
-  case 1:
-    // blank line
-    channel_config_set_ring(&sync_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(sync_timing_dma_channel, &sync_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(
-        sync_timing_dma_channel, sync_timing_blank_line,
-        SYNC_TIMING_BLANK_LINE_LEN *
-            (active_mode->visible_start_line - active_mode->vsync_lines_per_frame));
-    frame_phase = 2;
-    break;
-  case 2:
-    // visible line
-    channel_config_set_ring(&sync_timing_dma_channel_config, false, 4);
-    dma_channel_set_config(sync_timing_dma_channel, &sync_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(sync_timing_dma_channel, sync_timing_visible_line,
-                                         SYNC_TIMING_VISIBLE_LINE_LEN *
-                                             active_mode->visible_lines_per_frame);
-    frame_phase = 3;
-    break;
-  case 3:
-    // blank line
-    channel_config_set_ring(&sync_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(sync_timing_dma_channel, &sync_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(sync_timing_dma_channel, sync_timing_blank_line,
-                                         SYNC_TIMING_BLANK_LINE_LEN *
-                                             (active_mode->lines_per_frame -
-                                              active_mode->visible_start_line -
-                                              active_mode->visible_lines_per_frame));
+    critical_section_enter_blocking(&stats_lock);
+    stats.vblank_time_us = entry_us;
+    critical_section_exit(&stats_lock);
 
     // Release the vblank semaphore which will wake anything waiting on it.
     sem_release(&vblank_semaphore);
@@ -275,9 +551,37 @@ static void sync_timing_dma_handler() {
     if (vblank_callback != NULL) {
       vblank_callback();
     }
+  }
+}
+
+// DMA handler called when each visible line has been transferred when generating lines on the fly.
+static void __not_in_flash_func(video_dma_handler)() {
+  dma_channel_acknowledge_irq1(video_dma_channel);
 
-    frame_phase = 0;
-    break;
+  if ((active_mode == NULL) || (line_renderer == NULL) || !videoout_is_running) {
+    return;
+  }
+
+  uint done_line = line_renderer_dma_line;
+  uint next_line = done_line + 1;
+  if (next_line >= active_mode->visible_lines_per_frame) {
+    return;
+  }
+
+  // Start the next line first since the PIO FIFO only holds a few words.
+  dma_channel_transfer_from_buffer_now(video_dma_channel,
+                                       line_buffers[next_line % VIDEOOUT_LINE_BUFFER_COUNT],
+                                       active_mode->visible_dots_per_line >> 4);
+  line_renderer_dma_line = next_line;
+
+  // The buffer for the line just transferred is now free.
+  uint render_line = done_line + VIDEOOUT_LINE_BUFFER_COUNT;
+  if (render_line < active_mode->visible_lines_per_frame) {
+    uint8_t *buffer = line_buffers[render_line % VIDEOOUT_LINE_BUFFER_COUNT];
+    line_renderer(render_line, buffer);
+    if (cursor_on_line(render_line)) {
+      cursor_invert_line(buffer);
+    }
   }
 }
 
@@ -293,6 +597,9 @@ static inline void all_static_asserts() {
   static_assert(SYNC_TIMING_VISIBLE_LINE_LEN == 4);
   static_assert(alignof(sync_timing_vsync_line) == sizeof(sync_timing_vsync_line));
   static_assert(SYNC_TIMING_VSYNC_LINE_LEN == 2);
+
+  // The health counters hold one timestamp per phase.
+  static_assert(sizeof(stats.phase_start_us) == sizeof(sync_timing_phase_start_us));
 }
 
 void videoout_init(PIO pio, uint sync_pin_base_, uint video_pin_base_) {
@@ -301,6 +608,11 @@ void videoout_init(PIO pio, uint sync_pin_base_, uint video_pin_base_) {
   // Record which PIO instance is used.
   pio_instance = pio;
 
+  // Give DMA priority over the processors where they contend for a RAM bank, so that drawing into
+  // the frame buffer cannot hold up the video data.
+  hw_set_bits(&bus_ctrl_hw->priority,
+              BUSCTRL_BUS_PRIORITY_DMA_R_BITS | BUSCTRL_BUS_PRIORITY_DMA_W_BITS);
+
   // Ensure IRQ 4 of the PIO is clear
   pio_interrupt_clear(pio_instance, 4);
 
@@ -318,35 +630,208 @@ void videoout_init(PIO pio, uint sync_pin_base_, uint video_pin_base_) {
   sync_timing_dma_channel = dma_claim_unused_channel(true);
   sync_timing_dma_channel_config =
       get_sync_timing_dma_channel_config(sync_timing_dma_channel, pio_instance, sync_timing_sm);
-  dma_channel_set_write_addr(sync_timing_dma_channel, &pio_instance->txf[sync_timing_sm], false);
   dma_channel_set_irq0_enabled(sync_timing_dma_channel, true);
 
-  // Configure DMA channel for copying frame buffer to video output.
+  // Configure the frame timing control DMA channel to write one control block at a time to the
+  // frame timing channel's registers, wrapping around to CTRL after TRANS_COUNT_TRIG.
+  sync_timing_control_dma_channel = dma_claim_unused_channel(true);
+  dma_channel_config control_dma_channel_config =
+      get_sync_timing_control_dma_channel_config(sync_timing_control_dma_channel);
+  sync_timing_timestamp_dma_channel = dma_claim_unused_channel(true);
+  channel_config_set_chain_to(&control_dma_channel_config, sync_timing_timestamp_dma_channel);
+  dma_channel_configure(sync_timing_control_dma_channel, &control_dma_channel_config,
+                        &dma_hw->ch[sync_timing_dma_channel].al1_ctrl, sync_timing_control_blocks,
+                        4, false);
+
+  // Configure the frame timing timestamp DMA channel to copy the raw timer into the next entry of
+  // sync_timing_phase_start_us[] each time the control channel finishes.
+  dma_channel_config timestamp_dma_channel_config =
+      dma_channel_get_default_config(sync_timing_timestamp_dma_channel);
+  channel_config_set_transfer_data_size(&timestamp_dma_channel_config, DMA_SIZE_32);
+  channel_config_set_read_increment(&timestamp_dma_channel_config, false);
+  channel_config_set_write_increment(&timestamp_dma_channel_config, true);
+  channel_config_set_ring(&timestamp_dma_channel_config, true, 4);
+  dma_channel_configure(sync_timing_timestamp_dma_channel, &timestamp_dma_channel_config,
+                        sync_timing_phase_start_us, &timer_hw->timerawl, 1, false);
+
+  // Configure the frame timing loop DMA channel to restart the control channel at the end of each
+  // frame. It raises DMA IRQ 0 to start the video data for the next field.
+  sync_timing_loop_dma_channel = dma_claim_unused_channel(true);
+  dma_channel_config loop_dma_channel_config =
+      dma_channel_get_default_config(sync_timing_loop_dma_channel);
+  channel_config_set_read_increment(&loop_dma_channel_config, false);
+  dma_channel_configure(sync_timing_loop_dma_channel, &loop_dma_channel_config,
+                        &dma_hw->ch[sync_timing_control_dma_channel].al3_read_addr_trig,
+                        &sync_timing_restart_blocks, 1, false);
+  dma_channel_set_irq0_enabled(sync_timing_loop_dma_channel, true);
+
+  // The stop block leaves the frame timing channel disabled.
+  dma_channel_config stop_config = sync_timing_dma_channel_config;
+  channel_config_set_enable(&stop_config, false);
+  sync_timing_stop_block[0] = channel_config_get_ctrl_value(&stop_config);
+
+  // Configure DMA channel for copying frame buffer to video output. It chains to the line table
+  // DMA channel unless lines are generated on the fly.
   video_dma_channel = dma_claim_unused_channel(true);
-  dma_channel_config video_dma_channel_config =
+  line_table_dma_channel = dma_claim_unused_channel(true);
+  video_dma_channel_config =
       get_video_output_dma_channel_config(video_dma_channel, pio_instance, video_output_sm, true);
+  channel_config_set_chain_to(&video_dma_channel_config,
+                              (line_renderer != NULL) ? video_dma_channel : line_table_dma_channel);
   dma_channel_set_config(video_dma_channel, &video_dma_channel_config, false);
   dma_channel_set_write_addr(video_dma_channel, &pio_instance->txf[video_output_sm], false);
 
+  // Configure DMA channel for feeding the line table to the video data DMA channel.
+  dma_channel_config line_table_dma_channel_config =
+      get_line_table_dma_channel_config(line_table_dma_channel);
+  dma_channel_configure(line_table_dma_channel, &line_table_dma_channel_config,
+                        &dma_hw->ch[video_dma_channel].al3_read_addr_trig, line_table, 1, false);
+
   videoout_set_mode(default_mode);
 
+  sem_init(&present_semaphore, 1, 1);
+  critical_section_init(&cursor_lock);
+  critical_section_init(&stats_lock);
+
   // Enable interrupt handler for frame timing.
   irq_set_exclusive_handler(DMA_IRQ_0, sync_timing_dma_handler);
   irq_set_enabled(DMA_IRQ_0, true);
+
+  // Enable interrupt handler for lines generated on the fly. The video DMA channel only raises it
+  // when a line renderer is set.
+  irq_set_exclusive_handler(DMA_IRQ_1, video_dma_handler);
+  irq_set_enabled(DMA_IRQ_1, true);
 }
 
 bool videoout_set_mode(const videoout_mode_t *mode) {
   if (videoout_is_running) {
     return false;
   }
-  if (!mode_is_valid(mode)) {
+  if (!videoout_mode_is_valid(mode)) {
+    return false;
+  }
+  if (mode->visible_lines_per_frame > MAX_VISIBLE_LINES) {
+    return false;
+  }
+  if ((line_renderer != NULL) && (mode->visible_dots_per_line > VIDEOOUT_LINE_BUFFER_MAX_DOTS)) {
+    return false;
+  }
+  if ((clock_get_hz(clk_sys) != mode->sys_clock_khz * 1000) &&
+      !set_sys_clock_khz(mode->sys_clock_khz, false)) {
     return false;
   }
   mode_setup(mode);
+  sync_timing_control_blocks_setup(mode);
+  uint64_t line_cycles = (uint64_t)mode->dots_per_line * mode->sys_clocks_per_dot;
+  stats_frame_cycles = line_cycles * mode->lines_per_frame;
+  stats_field_deadline_us = (line_cycles * mode->visible_start_line * 1000) / mode->sys_clock_khz;
   active_mode = mode;
   return true;
 }
 
+// Number of dots nearest to t_ns.
+static inline uint solve_dots(uint t_ns, uint sys_clock_khz, uint sys_clocks_per_dot) {
+  uint64_t d = (uint64_t)sys_clocks_per_dot * 1000000;
+  return ((uint64_t)t_ns * sys_clock_khz + (d >> 1)) / d;
+}
+
+// Time of n dots less t_ns, in ps.
+static inline int solve_error_ps(uint n, uint t_ns, uint sys_clock_khz, uint sys_clocks_per_dot) {
+  uint64_t n_ps =
+      ((uint64_t)n * sys_clocks_per_dot * 1000000000 + (sys_clock_khz >> 1)) / sys_clock_khz;
+  return (int)((int64_t)n_ps - ((int64_t)t_ns * 1000));
+}
+
+// Try a system clock and dot clock divider for target and keep it in best if it is valid and closer
+// than any tried so far.
+static void solve_try(const videoout_mode_target_t *target, uint sys_clock_khz,
+                      uint sys_clocks_per_dot, videoout_mode_t *best, videoout_mode_error_t *error,
+                      uint64_t *best_cost) {
+  videoout_mode_t m = {
+      .visible_dots_per_line = target->visible_dots_per_line,
+      .visible_lines_per_frame = target->visible_lines_per_frame,
+      .sys_clock_khz = sys_clock_khz,
+      .sys_clocks_per_dot = sys_clocks_per_dot,
+      .dots_per_line = solve_dots(target->line_period_ns, sys_clock_khz, sys_clocks_per_dot),
+      .lines_per_frame = target->lines_per_frame,
+      .vsync_lines_per_frame = target->vsync_lines_per_frame,
+      .visible_start_line = target->visible_start_line,
+      .hsync_dots = solve_dots(target->hsync_width_ns, sys_clock_khz, sys_clocks_per_dot),
+  };
+  if (!videoout_mode_is_valid(&m)) {
+    return;
+  }
+
+  videoout_mode_error_t e = {
+      .line_period_ps = solve_error_ps(m.dots_per_line, target->line_period_ns, sys_clock_khz,
+                                       sys_clocks_per_dot),
+      .visible_width_ps = solve_error_ps(m.visible_dots_per_line, target->visible_width_ns,
+                                         sys_clock_khz, sys_clocks_per_dot),
+      .hsync_width_ps =
+          solve_error_ps(m.hsync_dots, target->hsync_width_ns, sys_clock_khz, sys_clocks_per_dot),
+  };
+
+  // Timing error first, then distance from the default clock, then the lower clock and then an even
+  // divider, which keeps the video output state machine's cycles even.
+  uint64_t cost = ((uint64_t)(abs(e.line_period_ps) + abs(e.visible_width_ps)) << 32) |
+                  ((uint)abs((int)sys_clock_khz - DEFAULT_SYS_CLOCK_KHZ) << 2) |
+                  ((sys_clock_khz > DEFAULT_SYS_CLOCK_KHZ) << 1) | (sys_clocks_per_dot & 1);
+  if (cost < *best_cost) {
+    *best_cost = cost;
+    *best = m;
+    *error = e;
+  }
+}
+
+bool videoout_solve_mode(const videoout_mode_target_t *target, videoout_mode_t *mode,
+                         videoout_mode_error_t *error) {
+  uint max_sys_clock_khz =
+      (target->max_sys_clock_khz != 0) ? target->max_sys_clock_khz : VIDEOOUT_MAX_SYS_CLOCK_KHZ;
+  if (target->visible_dots_per_line == 0) {
+    return false;
+  }
+
+  videoout_mode_t best;
+  videoout_mode_error_t best_error;
+  uint64_t best_cost = UINT64_MAX;
+
+  // The system clocks are those set_sys_clock_khz() can set exactly: the VCO divided by both post
+  // dividers, the second no larger than the first.
+  for (uint fbdiv = 16; fbdiv <= 320; fbdiv++) {
+    uint vco_khz = PLL_REF_KHZ * fbdiv;
+    if ((vco_khz < PLL_VCO_MIN_KHZ) || (vco_khz > PLL_VCO_MAX_KHZ)) {
+      continue;
+    }
+    for (uint postdiv1 = 1; postdiv1 <= 7; postdiv1++) {
+      for (uint postdiv2 = 1; postdiv2 <= postdiv1; postdiv2++) {
+        uint postdiv = postdiv1 * postdiv2;
+        uint sys_clock_khz = vco_khz / postdiv;
+        if (((vco_khz % postdiv) != 0) || (sys_clock_khz < MIN_SYS_CLOCK_KHZ) ||
+            (sys_clock_khz > max_sys_clock_khz)) {
+          continue;
+        }
+
+        // The nearest divider gives the least visible width error but one either side may give
+        // less line period error.
+        uint64_t d = (uint64_t)target->visible_dots_per_line * 1000000;
+        uint nearest = ((uint64_t)target->visible_width_ns * sys_clock_khz + (d >> 1)) / d;
+        for (uint div = (nearest > 2) ? nearest - 1 : 2; div <= nearest + 1; div++) {
+          solve_try(target, sys_clock_khz, div, &best, &best_error, &best_cost);
+        }
+      }
+    }
+  }
+
+  if (best_cost == UINT64_MAX) {
+    return false;
+  }
+  *mode = best;
+  if (error != NULL) {
+    *error = best_error;
+  }
+  return true;
+}
+
 void videoout_start(void) {
   if (videoout_is_running || (active_mode == NULL)) {
     return;
@@ -355,9 +840,9 @@ void videoout_start(void) {
   sem_init(&vblank_semaphore, 0, 1);
 
   video_output_program_init(pio_instance, video_output_sm, video_output_offset, video_pin_base,
-                            mode_dot_clock_period_ns(active_mode));
+                            active_mode->sys_clocks_per_dot);
   sync_timing_program_init(pio_instance, sync_timing_sm, sync_timing_offset, sync_pin_base,
-                           mode_dot_clock_period_ns(active_mode));
+                           active_mode->sys_clocks_per_dot);
 
   pio_sm_restart(pio_instance, video_output_sm);
   pio_sm_put(pio_instance, video_output_sm, active_mode->visible_dots_per_line - 1);
@@ -365,10 +850,16 @@ void videoout_start(void) {
   pio_sm_restart(pio_instance, sync_timing_sm);
   pio_sm_set_enabled(pio_instance, sync_timing_sm, true);
 
-  // Start frame timing.
+  // Start the first field and the frame timing. From then on the loop channel restarts the frame
+  // timing at the end of each frame.
   videoout_is_running = true;
-  frame_phase = 0;
-  sync_timing_dma_handler();
+  stats_frame_started = false;
+  pio_instance->fdebug = (1u << (PIO_FDEBUG_TXSTALL_LSB + video_output_sm)) |
+                         (1u << (PIO_FDEBUG_TXSTALL_LSB + sync_timing_sm));
+  dma_channel_set_write_addr(sync_timing_timestamp_dma_channel, sync_timing_phase_start_us, false);
+  sync_timing_restart_blocks = &sync_timing_control_blocks[0][0];
+  field_start();
+  dma_channel_set_read_addr(sync_timing_control_dma_channel, sync_timing_restart_blocks, true);
 }
 
 void videoout_stop(void) {
@@ -377,7 +868,29 @@ void videoout_stop(void) {
   }
 
   videoout_is_running = false;
-  dma_channel_wait_for_finish_blocking(video_dma_channel);
+
+  // Let the current field finish. The line table is NULL terminated and so the video data DMA
+  // channel stops after the last visible line.
+  while (dma_channel_is_busy(line_table_dma_channel) || dma_channel_is_busy(video_dma_channel)) {
+    tight_loop_contents();
+  }
+
+  // Let the current frame finish. The loop channel then loads the stop block, after which the
+  // control channel's read address is left just past it.
+  sync_timing_restart_blocks = sync_timing_stop_block;
+  while (dma_channel_is_busy(sync_timing_control_dma_channel) ||
+         (dma_hw->ch[sync_timing_control_dma_channel].read_addr !=
+          (uintptr_t)(sync_timing_stop_block + 4))) {
+    tight_loop_contents();
+  }
+
+  // Show any pending present immediately rather than leaving it queued.
+  if (atomic_load_explicit(&present_pending, memory_order_acquire)) {
+    videoout_set_frame_buffer(present_frame_buffer);
+    videoout_set_scroll(present_scroll);
+    atomic_store_explicit(&present_pending, false, memory_order_relaxed);
+    sem_release(&present_semaphore);
+  }
 
   pio_sm_set_enabled(pio_instance, video_output_sm, false);
   pio_sm_set_enabled(pio_instance, sync_timing_sm, false);
@@ -385,8 +898,22 @@ void videoout_stop(void) {
 
 void videoout_cleanup(void) {
   irq_set_enabled(DMA_IRQ_0, false);
+  irq_set_enabled(DMA_IRQ_1, false);
+  hw_clear_bits(&bus_ctrl_hw->priority,
+                BUSCTRL_BUS_PRIORITY_DMA_R_BITS | BUSCTRL_BUS_PRIORITY_DMA_W_BITS);
+  gpio_set_outover(video_pin_base, GPIO_OVERRIDE_NORMAL);
+  gpio_set_outover(video_pin_base + 1, GPIO_OVERRIDE_NORMAL);
+  output_inverted = false;
   dma_channel_cleanup(video_dma_channel);
   dma_channel_unclaim(video_dma_channel);
+  dma_channel_cleanup(line_table_dma_channel);
+  dma_channel_unclaim(line_table_dma_channel);
+  dma_channel_cleanup(sync_timing_loop_dma_channel);
+  dma_channel_unclaim(sync_timing_loop_dma_channel);
+  dma_channel_cleanup(sync_timing_control_dma_channel);
+  dma_channel_unclaim(sync_timing_control_dma_channel);
+  dma_channel_cleanup(sync_timing_timestamp_dma_channel);
+  dma_channel_unclaim(sync_timing_timestamp_dma_channel);
   dma_channel_cleanup(sync_timing_dma_channel);
   dma_channel_unclaim(sync_timing_dma_channel);
 
@@ -418,4 +945,92 @@ void videoout_set_frame_buffer(void *frame_buffer) {
   atomic_store(&frame_buffer_ptr, (uintptr_t)frame_buffer);
 }
 
+void videoout_set_scroll(uint first_line) { atomic_store(&scroll_line, first_line); }
+
+void videoout_present(void *frame_buffer, uint first_line) {
+  if (!videoout_is_running) {
+    videoout_set_frame_buffer(frame_buffer);
+    videoout_set_scroll(first_line);
+    return;
+  }
+
+  sem_acquire_blocking(&present_semaphore);
+  present_frame_buffer = frame_buffer;
+  present_scroll = first_line;
+  atomic_store_explicit(&present_pending, true, memory_order_release);
+}
+
+void videoout_wait_for_present(void) {
+  sem_acquire_blocking(&present_semaphore);
+  sem_release(&present_semaphore);
+}
+
 void videoout_wait_for_vblank(void) { sem_acquire_blocking(&vblank_semaphore); }
+
+bool videoout_set_line_renderer(videoout_line_renderer_t renderer) {
+  if (videoout_is_running) {
+    return false;
+  }
+  if ((renderer != NULL) && (active_mode != NULL) &&
+      (active_mode->visible_dots_per_line > VIDEOOUT_LINE_BUFFER_MAX_DOTS)) {
+    return false;
+  }
+  line_renderer = renderer;
+  channel_config_set_chain_to(&video_dma_channel_config,
+                              (renderer != NULL) ? video_dma_channel : line_table_dma_channel);
+  dma_channel_set_config(video_dma_channel, &video_dma_channel_config, false);
+  dma_channel_set_irq1_enabled(video_dma_channel, renderer != NULL);
+  return true;
+}
+
+void videoout_set_cursor(uint x, uint y, uint width, uint height) {
+  cursor_t c = {.first_line = y, .n_lines = height};
+
+  // Clip to the widest line, which a cursor line copy holds.
+  if (x >= VIDEOOUT_LINE_BUFFER_MAX_DOTS) {
+    width = 0;
+  } else if (width > VIDEOOUT_LINE_BUFFER_MAX_DOTS - x) {
+    width = VIDEOOUT_LINE_BUFFER_MAX_DOTS - x;
+  }
+  if (height > VIDEOOUT_CURSOR_MAX_LINES) {
+    c.n_lines = VIDEOOUT_CURSOR_MAX_LINES;
+  }
+
+  // Each byte holds four pixels with the left-most in the two MSBs.
+  if (width == 0) {
+    c.n_lines = 0;
+  } else {
+    uint end = x + width;
+    c.first_byte = x >> 2;
+    c.n_bytes = ((end + 3) >> 2) - c.first_byte;
+    c.first_mask = 0xff >> ((x & 3) << 1);
+    c.last_mask = (end & 3) ? (uint8_t)(0xff << ((4 - (end & 3)) << 1)) : 0xff;
+  }
+
+  critical_section_enter_blocking(&cursor_lock);
+  next_cursor = c;
+  next_cursor_pending = true;
+  critical_section_exit(&cursor_lock);
+}
+
+void videoout_set_cursor_blink(uint period) { cursor_blink_period = period; }
+
+void videoout_set_reverse(bool reverse) { reverse_video = reverse; }
+
+void videoout_flash(uint n_fields) { flash_fields = n_fields; }
+
+void videoout_get_stats(videoout_stats_t *stats_out) {
+  critical_section_enter_blocking(&stats_lock);
+  *stats_out = stats;
+  stats_out->latency_avg_us =
+      (stats_latency_count == 0) ? 0 : (uint32_t)(stats_latency_sum_us / stats_latency_count);
+  critical_section_exit(&stats_lock);
+}
+
+void videoout_reset_stats(void) {
+  critical_section_enter_blocking(&stats_lock);
+  stats = (videoout_stats_t){0};
+  stats_latency_sum_us = 0;
+  stats_latency_count = 0;
+  critical_section_exit(&stats_lock);
+}
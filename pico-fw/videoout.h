@@ -1,28 +1,102 @@
 #include "pico/types.h"
 #include "hardware/pio.h"
 
-// Opaque video mode type.
-typedef struct videoout_mode videoout_mode_t;
+// Video mode. Horizontal timings are counted in dots, each sys_clocks_per_dot cycles of a system
+// clock of sys_clock_khz. The video output state machine runs at twice the dot clock, so an odd
+// sys_clocks_per_dot puts it on a half-integer divider. Its cycles then alternate in length, but
+// each dot, two of them, is still exactly sys_clocks_per_dot system clock cycles.
+typedef struct videoout_mode {
+  uint visible_dots_per_line;
+  uint visible_lines_per_frame;
 
-// Standard modes.
+  uint sys_clock_khz;
+  uint sys_clocks_per_dot;
+
+  uint dots_per_line;
+  uint lines_per_frame;
+  uint vsync_lines_per_frame;
+  uint visible_start_line;
+
+  uint hsync_dots;
+} videoout_mode_t;
+
+// Standard modes, generated by make_video_modes.py. videoout_mode_1056_350 is for 132 columns of 8
+// dot characters.
 extern videoout_mode_t videoout_mode_720_350;
 extern videoout_mode_t videoout_mode_864_350;
 extern videoout_mode_t videoout_mode_1024_350;
+extern videoout_mode_t videoout_mode_1056_350;
+
+// Highest system clock considered by videoout_solve_mode() unless the target gives another.
+#define VIDEOOUT_MAX_SYS_CLOCK_KHZ 133000
+
+// Timing wanted from videoout_solve_mode(), in ns.
+typedef struct {
+  uint visible_dots_per_line;
+  uint visible_lines_per_frame;
+
+  uint line_period_ns;
+  uint visible_width_ns;
+  uint hsync_width_ns;
+  uint lines_per_frame;
+  uint vsync_lines_per_frame;
+  uint visible_start_line;
+
+  // Highest system clock to consider, or 0 for VIDEOOUT_MAX_SYS_CLOCK_KHZ.
+  uint max_sys_clock_khz;
+} videoout_mode_target_t;
+
+// Solved timing less the target timing, in ps.
+typedef struct {
+  int line_period_ps;
+  int visible_width_ps;
+  int hsync_width_ps;
+} videoout_mode_error_t;
 
 // Callback to be notified of video blanking period start.
 typedef void (*videoout_vblank_callback_t) (void);
 
-// Video out uses two DMA channels claimed via dma_claim_unused_channel(), DMA IRQ 0, two PIO state
+// Callback used to generate visible lines on the fly. Called from interrupt context with the index
+// of the visible line to generate and a buffer of videoout_get_screen_stride() bytes to fill in the
+// frame buffer format described for videoout_set_frame_buffer().
+typedef void (*videoout_line_renderer_t) (uint line, void *buffer);
+
+// Number of line buffers in the ring used when lines are generated on the fly. Lines are generated
+// this many lines ahead of the line currently being output.
+#define VIDEOOUT_LINE_BUFFER_COUNT 4
+
+// Maximum number of visible dots per line supported when lines are generated on the fly and by the
+// cursor. Covers the widest standard mode.
+#define VIDEOOUT_LINE_BUFFER_MAX_DOTS 1056
+
+// Video out uses six DMA channels claimed via dma_claim_unused_channel(), DMA IRQ 0, two PIO state
 // machines and IRQ for the PIO instance containing the state machines. Pass a PIO instance to
-// videoout_init() to specify which instance is used.
+// videoout_init() to specify which instance is used. DMA IRQ 1 is also used when lines are
+// generated on the fly via videoout_set_line_renderer(). The sync timing is generated entirely by
+// DMA. DMA IRQ 0 is raised twice a frame, to start the video data for the next field and to
+// signal vblank, and only the former must be handled before the first visible line.
 //
 // The VSYNC GPIO is sync_pin_base, HSYNC is sync_pin_base + 1.
 // The !DIM GPIO is video_pin_base, VIDEO is video_pin_base + 1.
 void videoout_init(PIO pio, uint sync_pin_base, uint video_pin_base);
 
-// Must be called with output stopped. Return true if mode set successful.
+// Return true if mode's timing can be generated: sys_clocks_per_dot is 2 to 0xffff, the visible
+// width is a multiple of 16 dots and every state of the sync timing programs fits its cycle count. Checked by
+// videoout_set_mode() and videoout_solve_mode().
+bool videoout_mode_is_valid(const videoout_mode_t *mode);
+
+// Must be called with output stopped. Return true if mode set successful. The system clock is
+// changed to the mode's if it differs.
 bool videoout_set_mode(const videoout_mode_t *mode);
 
+// Search the system clocks the system PLL can make, from 100MHz up, and the dot clock dividers of
+// each for the valid mode closest to target. The line period and visible width errors are weighed
+// equally, ties go to the clock nearest 125MHz and then to an even divider. Fill in mode and, unless NULL,
+// error and return true, or return false if there is no valid mode. The same search generates the
+// standard modes.
+bool videoout_solve_mode(const videoout_mode_target_t *target, videoout_mode_t *mode,
+                         videoout_mode_error_t *error);
+
 // Start video out. videoout_init() must have been called first.
 void videoout_start(void);
 
@@ -52,7 +126,82 @@ void videoout_set_vblank_callback(videoout_vblank_callback_t callback);
 // | 01   | Black      |
 // | 10   | Dim        |
 // | 11   | Bright     |
+//
+// Each visible line is fetched separately via a table of line addresses so that the frame buffer
+// rows need not be shown in memory order. See videoout_set_scroll().
 void videoout_set_frame_buffer(void *frame_buffer);
 
+// Set the frame buffer row shown on the first visible line. Visible line i shows frame buffer row
+// (first_line + i) modulo the screen height. This scrolls the display without moving any pixels.
+// Takes effect from the start of the next field.
+void videoout_set_scroll(uint first_line);
+
+// Queue a frame buffer and scroll, as for videoout_set_frame_buffer() and videoout_set_scroll(), to
+// be shown together from the start of the next field. This allows tear-free double buffering: draw
+// into one buffer while the other is shown then present it. Waits for any previous present to
+// complete first.
+void videoout_present(void *frame_buffer, uint first_line);
+
+// Wait until the most recently presented frame buffer is being shown. After this returns the
+// previously shown frame buffer is no longer scanned out and may be drawn into.
+void videoout_wait_for_present(void);
+
+// Generate each visible line on the fly via a callback instead of scanning out a frame buffer. The
+// callback is called from the video DMA interrupt VIDEOOUT_LINE_BUFFER_COUNT - 1 lines ahead of the
+// line being output and so must take less than one line period on average. Pass NULL to return to
+// scanning out the frame buffer. Must be called with output stopped. Return true if successful.
+bool videoout_set_line_renderer(videoout_line_renderer_t renderer);
+
 // Wait until the next vblank interval
 void videoout_wait_for_vblank(void);
+
+// Maximum number of lines covered by the cursor.
+#define VIDEOOUT_CURSOR_MAX_LINES 16
+
+// Overlay a cursor on the output by inverting each pixel in the width x height rectangle whose top
+// left is visible dot x of visible line y. The frame buffer and any line renderer output are left
+// unchanged. Pass a width or height of zero to hide the cursor. Lines beyond
+// VIDEOOUT_CURSOR_MAX_LINES are not covered. Takes effect from the start of the next field, which
+// also restarts any blink with the cursor shown.
+//
+// When scanning out a frame buffer, the cursor's lines are copied at the start of each field, so a
+// change drawn to them part way through a field is only shown from the next one. The cursor is not
+// shown for modes wider than VIDEOOUT_LINE_BUFFER_MAX_DOTS.
+void videoout_set_cursor(uint x, uint y, uint width, uint height);
+
+// Blink the cursor, showing and then hiding it for period fields each. Pass zero to show it
+// steadily.
+void videoout_set_cursor_blink(uint period);
+
+// Show the whole output in reverse video by inverting the VIDEO and !DIM outputs, so black is shown
+// bright and bright and dim are shown black. Blanking is unaffected. Takes effect from the start of
+// the next field.
+void videoout_set_reverse(bool reverse);
+
+// Show the output with the opposite of its current reverse video setting for the next n fields,
+// such as for a visual bell.
+void videoout_flash(uint n_fields);
+
+// Health counters of the video pipeline, for correlating glitches with load. Times are from
+// time_us_32().
+typedef struct {
+  uint32_t frames;           // frames output since the counters were reset
+  uint32_t missed_frames;    // frames whose start was not handled at all
+  uint32_t late_fields;      // fields whose video data was started after the first visible line
+  uint32_t video_underflows; // fields in which the video output found its FIFO empty
+  uint32_t sync_underflows;  // frames in which the sync timing found its FIFO empty
+
+  // Latency of the frame start interrupt, from the DMA starting the frame to the handler, in us.
+  uint32_t latency_min_us, latency_max_us, latency_avg_us;
+
+  // Times the vsync, blank, visible and blank phases of the most recent frame were started by DMA
+  // and time the most recent vblank was handled.
+  uint32_t phase_start_us[4];
+  uint32_t vblank_time_us;
+} videoout_stats_t;
+
+// Copy a consistent snapshot of the health counters into stats.
+void videoout_get_stats(videoout_stats_t *stats);
+
+// Zero the health counters.
+void videoout_reset_stats(void);
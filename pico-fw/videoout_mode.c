@@ -0,0 +1,59 @@
+#include "videoout.h"
+
+// The checks made on a mode's timing by videoout_set_mode() and videoout_solve_mode(), kept apart
+// from the hardware so that they can also be run on the host. Keep in step with make_video_modes.py.
+
+// Return true if a sync timing state of n dots fits the 14 bit cycle count of sync_timing_encode().
+static inline bool sync_timing_dots_valid(uint n) { return (n >= 5) && (n - 5 <= 0x3fff); }
+
+bool videoout_mode_is_valid(const videoout_mode_t *m) {
+  if (m->sys_clock_khz == 0) {
+    return false;
+  }
+  // The sync timing state machine's divider is sys_clocks_per_dot, a 16 bit integer.
+  if ((m->sys_clocks_per_dot < 2) || (m->sys_clocks_per_dot > 0xffff)) {
+    return false;
+  }
+  if ((m->visible_dots_per_line & 0xf) != 0) {
+    return false;
+  }
+  if (m->dots_per_line <= m->visible_dots_per_line) {
+    return false;
+  }
+  // Dots from the end of hsync to the first visible dot.
+  uint back_porch_dots = m->dots_per_line - m->visible_dots_per_line;
+  if (back_porch_dots == m->hsync_dots) {
+    return false;
+  }
+
+  // Every state of the timing programs built by mode_setup() in videoout.c must fit.
+  uint visible_line_states[4];
+  if (back_porch_dots < m->hsync_dots) {
+    visible_line_states[0] = back_porch_dots;
+    visible_line_states[1] = m->hsync_dots - back_porch_dots;
+    visible_line_states[3] = m->dots_per_line - m->hsync_dots - 16;
+  } else {
+    visible_line_states[0] = m->hsync_dots;
+    visible_line_states[1] = back_porch_dots - m->hsync_dots;
+    visible_line_states[3] = m->visible_dots_per_line - 16;
+  }
+  visible_line_states[2] = 16;
+  for (uint i = 0; i < 4; i++) {
+    if (!sync_timing_dots_valid(visible_line_states[i])) {
+      return false;
+    }
+  }
+  if (!sync_timing_dots_valid(m->hsync_dots) ||
+      !sync_timing_dots_valid(m->dots_per_line - m->hsync_dots)) {
+    return false;
+  }
+
+  if (m->lines_per_frame <= m->vsync_lines_per_frame + m->vsync_lines_per_frame) {
+    return false;
+  }
+  if (m->lines_per_frame <= m->visible_start_line + m->visible_lines_per_frame) {
+    return false;
+  }
+
+  return true;
+}